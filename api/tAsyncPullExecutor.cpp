@@ -0,0 +1,232 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/api/tAsyncPullExecutor.cpp
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/data_ports/api/tAsyncPullExecutor.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/tGenericPort.h"
+#include "plugins/data_ports/common/tAbstractDataPort.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace api
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace internal
+{
+
+/*!
+ * Deletion observer of data ports (see common::tAbstractDataPort::AddDeletionObserver())
+ *
+ * \param port Port that is deleted
+ */
+static void PortDeleted(common::tAbstractDataPort& port)
+{
+  tAsyncPullExecutor::GetInstance().PortDeleted(port);
+}
+
+}
+
+tAsyncPullExecutor::tAsyncPullExecutor() :
+  mutex(),
+  queue_not_empty(),
+  pull_completed(),
+  queue(),
+  pending_pulls(),
+  worker_threads(),
+  stop(false)
+{
+  common::tAbstractDataPort::AddDeletionObserver(&internal::PortDeleted);
+}
+
+void tAsyncPullExecutor::Execute(core::tAbstractPort& port, std::unique_lock<std::mutex>& lock)
+{
+  std::exception_ptr exception;
+  try
+  {
+    tGenericPort::Wrap(port).GetPointer(tStrategy::PULL);  // pulled value becomes port's current value
+  }
+  catch (...)
+  {
+    exception = std::current_exception();
+  }
+
+  lock.lock();
+  auto it = pending_pulls.find(&port);
+  assert(it != pending_pulls.end() && it->second.running);
+  std::promise<void> promise = std::move(it->second.promise);
+  pending_pulls.erase(it);  // pull requests from now on start a new operation
+  if (exception)
+  {
+    promise.set_exception(exception);
+  }
+  else
+  {
+    promise.set_value();
+  }
+  pull_completed.notify_all();
+}
+
+tAsyncPullExecutor& tAsyncPullExecutor::GetInstance()
+{
+  static tAsyncPullExecutor* instance = new tAsyncPullExecutor();
+  return *instance;
+}
+
+void tAsyncPullExecutor::PortDeleted(core::tAbstractPort& port)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  auto it = pending_pulls.find(&port);
+  while (it != pending_pulls.end() && it->second.running)
+  {
+    pull_completed.wait(lock);
+    it = pending_pulls.find(&port);
+  }
+  if (it != pending_pulls.end())
+  {
+    queue.erase(std::remove(queue.begin(), queue.end(), &port), queue.end());
+    it->second.promise.set_exception(std::make_exception_ptr(std::runtime_error("Port was deleted before pull operation was executed")));
+    pending_pulls.erase(it);
+  }
+}
+
+std::shared_future<void> tAsyncPullExecutor::Pull(core::tAbstractPort& port)
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  auto it = pending_pulls.find(&port);
+  if (it != pending_pulls.end())
+  {
+    return it->second.future;
+  }
+
+  tPendingPull& pending_pull = pending_pulls[&port];
+  pending_pull.future = pending_pull.promise.get_future().share();
+  std::shared_future<void> future = pending_pull.future;
+  if (worker_threads.empty())
+  {
+    pending_pull.running = true;
+    lock.unlock();
+    Execute(port, lock);
+    return future;
+  }
+  queue.push_back(&port);
+  queue_not_empty.notify_one();
+  return future;
+}
+
+void tAsyncPullExecutor::Run()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true)
+  {
+    queue_not_empty.wait(lock, [this]()
+    {
+      return stop || (!queue.empty());
+    });
+    if (queue.empty())
+    {
+      return;  // stop was signalled and queue is drained
+    }
+    core::tAbstractPort* port = queue.front();
+    queue.pop_front();
+    pending_pulls[port].running = true;
+    lock.unlock();
+    Execute(*port, lock);
+  }
+}
+
+void tAsyncPullExecutor::StartWorkerThreads(size_t thread_count)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!worker_threads.empty())
+  {
+    return;
+  }
+  stop = false;
+  for (size_t i = 0; i < thread_count; i++)
+  {
+    worker_threads.emplace_back(&tAsyncPullExecutor::Run, this);
+  }
+}
+
+void tAsyncPullExecutor::StopWorkerThreads()
+{
+  std::vector<std::thread> threads_to_stop;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+    std::swap(threads_to_stop, worker_threads);
+  }
+  queue_not_empty.notify_all();
+  for (std::thread & worker_thread : threads_to_stop)
+  {
+    worker_thread.join();
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,195 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/api/tAsyncPullExecutor.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tAsyncPullExecutor
+ *
+ * \b tAsyncPullExecutor
+ *
+ * Worker threads that execute asynchronous pull operations.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__api__tAsyncPullExecutor_h__
+#define __plugins__data_ports__api__tAsyncPullExecutor_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "core/port/tAbstractPort.h"
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace api
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Executor for asynchronous pull operations
+/*!
+ * Executes pull operations on a small pool of worker threads.
+ * Like tDeferredListenerDispatcher's worker thread, these threads are started and stopped explicitly
+ * (see StartWorkerThreads() and StopWorkerThreads()). While no worker threads are running
+ * (always the case in single-threaded mode), pull operations are executed in the calling thread.
+ *
+ * Pull operations of the same port that are requested while one is queued or running
+ * are deduplicated - they share the result of this operation.
+ * Queued pull operations are dropped when their port is deleted (see PortDeleted() -
+ * the executor registers itself as deletion observer of data ports on construction).
+ */
+class tAsyncPullExecutor : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Default number of worker threads */
+  enum { cWORKER_THREADS = 2 };
+
+  /*!
+   * \return Executor singleton (never deleted - so no threads are joined during static destruction)
+   */
+  static tAsyncPullExecutor& GetInstance();
+
+  /*!
+   * Called when port is deleted:
+   * Drops queued pull operation on this port - and waits for running one to complete.
+   * Futures of dropped operations are completed with an exception.
+   *
+   * \param port Port that is deleted
+   */
+  void PortDeleted(core::tAbstractPort& port);
+
+  /*!
+   * Starts pull operation on port - or joins pending pull operation on this port.
+   * Once the operation has completed, the pulled value is the port's current value.
+   *
+   * \param port (Wrapped) port to pull value of
+   * \return Future that becomes ready when pull operation has completed (contains exception if pull operation failed)
+   */
+  std::shared_future<void> Pull(core::tAbstractPort& port);
+
+  /*!
+   * Starts worker threads that execute pull operations (does nothing if they are already running)
+   *
+   * \param thread_count Number of worker threads
+   */
+  void StartWorkerThreads(size_t thread_count = cWORKER_THREADS);
+
+  /*!
+   * Stops worker threads (if running) - after they have executed the pull operations that are currently queued
+   */
+  void StopWorkerThreads();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Pending pull operation */
+  struct tPendingPull
+  {
+    /*! Promise that is fulfilled when pull operation has completed */
+    std::promise<void> promise;
+
+    /*! Future of promise (handed out to all callers) */
+    std::shared_future<void> future;
+
+    /*! Is pull operation currently being executed? */
+    bool running;
+
+    tPendingPull() : promise(), future(), running(false) {}
+  };
+
+  /*! Mutex for all variables below */
+  std::mutex mutex;
+
+  /*! Signals worker threads that queue is not empty (or that worker threads are to be stopped) */
+  std::condition_variable queue_not_empty;
+
+  /*! Signals threads in PortDeleted() that a pull operation has completed */
+  std::condition_variable pull_completed;
+
+  /*! Ports to pull values of (in order of requests) */
+  std::deque<core::tAbstractPort*> queue;
+
+  /*! Pending (queued or running) pull operations - by port */
+  std::unordered_map<core::tAbstractPort*, tPendingPull> pending_pulls;
+
+  /*! Worker threads (empty if not running) */
+  std::vector<std::thread> worker_threads;
+
+  /*! Signals worker threads to terminate */
+  bool stop;
+
+
+  tAsyncPullExecutor();
+
+  /*!
+   * Executes pull operation and completes its pending pull entry
+   *
+   * \param port Port to pull value of (its pending pull entry must be marked running)
+   * \param lock Lock on 'mutex' (must not be locked on call - is locked on return)
+   */
+  void Execute(core::tAbstractPort& port, std::unique_lock<std::mutex>& lock);
+
+  /*! Main loop of worker threads */
+  void Run();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
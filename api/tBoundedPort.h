@@ -223,6 +223,7 @@ private:
     {
       if (bounds.GetOutOfBoundsAction() == tOutOfBoundsAction::DISCARD)
       {
+        this->IncrementCounter(common::tPortCounter::DROPPED_BY_BOUNDS);
         return false;
       }
       rrlib::time::tTimestamp timestamp = publishing_data.published_buffer->GetTimestamp();
@@ -245,6 +246,7 @@ private:
     {
       if (bounds.GetOutOfBoundsAction() == tOutOfBoundsAction::DISCARD)
       {
+        this->IncrementCounter(common::tPortCounter::DROPPED_BY_BOUNDS);
         return false;
       }
 
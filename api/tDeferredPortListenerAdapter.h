@@ -0,0 +1,183 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/api/tDeferredPortListenerAdapter.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tDeferredPortListenerAdapter
+ *
+ * \b tDeferredPortListenerAdapter
+ *
+ * Port listener adapter that places change events in a mailbox -
+ * from where they are delivered to the listener by a tDeferredListenerDispatcher.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__api__tDeferredPortListenerAdapter_h__
+#define __plugins__data_ports__api__tDeferredPortListenerAdapter_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/tChangeContext.h"
+#include "plugins/data_ports/tDeferredListenerDispatcher.h"
+#include "plugins/data_ports/api/tPortListenerAdapter.h"
+#include "plugins/data_ports/common/tSingleProducerRingBuffer.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace api
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Mailbox of deferred port listener
+/*!
+ * Stores change events (locked port buffers) until they are delivered to the listener.
+ *
+ * \tparam LISTENER Listener class (needs to implement a method void OnPortChange(TPointer& value, tChangeContext& change_context))
+ * \tparam TPointer Type of port data pointer that is passed to listener
+ */
+template <typename LISTENER, typename TPointer>
+class tDeferredListenerMailbox : public tDeferredListenerDispatcher::tMailbox
+{
+public:
+
+  tDeferredListenerMailbox(LISTENER& listener, tDeferredListenerDispatcher& dispatcher, size_t capacity) :
+    tDeferredListenerDispatcher::tMailbox(dispatcher),
+    target_listener(listener),
+    events(capacity)
+  {}
+
+  virtual void Clear() override
+  {
+    while (events.Dequeue().origin)
+    {}
+  }
+
+  virtual size_t Deliver() override
+  {
+    size_t delivered = 0;
+    tEvent event = events.Dequeue();
+    while (event.origin)
+    {
+      tChangeContext change_context(*event.origin, event.timestamp, event.change_type);
+      target_listener.OnPortChange(event.value, change_context);
+      delivered++;
+      event = events.Dequeue();
+    }
+    return delivered;
+  }
+
+  /*!
+   * Called by port listener adapter in publishing thread: places event in mailbox
+   */
+  void OnPortChange(TPointer& value, tChangeContext& change_context)
+  {
+    tEvent event;
+    event.value = std::move(value);
+    event.origin = &change_context.Origin();
+    event.timestamp = change_context.Timestamp();
+    event.change_type = change_context.ChangeType();
+    events.Enqueue(std::move(event));
+  }
+
+private:
+
+  /*! Pending change event */
+  struct tEvent
+  {
+    /*! Locked port buffer with new value */
+    TPointer value;
+
+    /*! Port that value comes from (NULL if event is empty) */
+    common::tAbstractDataPort* origin;
+
+    /*! Timestamp attached to new port value/buffer */
+    rrlib::time::tTimestamp timestamp;
+
+    /*! Type of change */
+    tChangeStatus change_type;
+
+    tEvent() : value(), origin(NULL), timestamp(rrlib::time::cNO_TIME), change_type(tChangeStatus::CHANGED)
+    {}
+  };
+
+  /*! Listener to deliver events to */
+  LISTENER& target_listener;
+
+  /*! Pending change events */
+  common::tSingleProducerRingBuffer<tEvent> events;
+};
+
+/*!
+ * Deferred port listener adapter.
+ * Reuses the adapters for smart pointer listeners - with the mailbox as their listener.
+ *
+ * \tparam TMailbox Mailbox type
+ * \tparam TAdapter Port listener adapter for smart pointer that forwards to TMailbox
+ */
+template <typename TMailbox, typename TAdapter>
+class tDeferredPortListenerAdapter : public TMailbox, public TAdapter
+{
+public:
+
+  template <typename LISTENER>
+  tDeferredPortListenerAdapter(LISTENER& listener, tDeferredListenerDispatcher& dispatcher, size_t mailbox_capacity) :
+    TMailbox(listener, dispatcher, mailbox_capacity),
+    TAdapter(static_cast<TMailbox&>(*this))
+  {
+    this->Register();
+  }
+
+  virtual void PortDeleted() override
+  {
+    this->Unregister();
+    TAdapter::PortDeleted();
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -206,8 +206,10 @@ public:
       typename optimized::tCheapCopyPort::tUnusedManagerPointer buffer(optimized::tGlobalBufferPools::Instance().GetUnusedBuffer(static_cast<tPortBase&>(port).GetCheaplyCopyableTypeIndex()).release());
       buffer->SetTimestamp(timestamp);
       buffer->GetObject().DeepCopyFrom(data);
-      common::tPublishOperation<optimized::tCheapCopyPort, typename optimized::tCheapCopyPort::tPublishingDataGlobalBuffer> publish_operation(buffer);
-      publish_operation.Execute<false, tChangeStatus::CHANGED, false, false>(static_cast<tPortBase&>(port));
+      standard::tEpochReclamation::tReadGuard epoch_guard;
+      const common::tAbstractDataPort::tPushPlan* push_plan = static_cast<tPortBase&>(port).GetPushPlan();
+      common::tPublishOperation<optimized::tCheapCopyPort, typename optimized::tCheapCopyPort::tPublishingDataGlobalBuffer> publish_operation(buffer, static_cast<tPortBase&>(port).GetPublishLockCount(push_plan));
+      publish_operation.Execute<false, tChangeStatus::CHANGED, false, false>(static_cast<tPortBase&>(port), push_plan);
     }
 #else
     static_cast<tPortBase&>(port).Publish(data, timestamp);
@@ -233,9 +235,11 @@ public:
 
   virtual void Get(core::tAbstractPort& port, rrlib::rtti::tGenericObject& result, rrlib::time::tTimestamp& timestamp) override
   {
-    typename tPortBase::tLockingManagerPointer mgr = static_cast<tPortBase&>(port).GetCurrentValueRaw();
-    result.DeepCopyFrom(mgr->GetObject());
-    timestamp = mgr->GetTimestamp();
+    static_cast<tPortBase&>(port).AccessCurrentValue([&](standard::tPortBufferManager & buffer)
+    {
+      result.DeepCopyFrom(buffer.GetObject());
+      timestamp = buffer.GetTimestamp();
+    });
   }
 
   virtual tPortDataPointer<const rrlib::rtti::tGenericObject> GetPointer(core::tAbstractPort& port, tStrategy strategy) override
@@ -198,8 +198,10 @@ public:
       else
       {
         optimized::tCheapCopyPort::tUnusedManagerPointer pointer(static_cast<optimized::tCheaplyCopiedBufferManager*>(data_buffer.implementation.Release()));
-        common::tPublishOperation<optimized::tCheapCopyPort, typename optimized::tCheapCopyPort::tPublishingDataGlobalBuffer> publish_operation(pointer);
-        publish_operation.Execute<false, tChangeStatus::CHANGED, false, false>(cc_port);
+        standard::tEpochReclamation::tReadGuard epoch_guard;
+        const common::tAbstractDataPort::tPushPlan* push_plan = cc_port.GetPushPlan();
+        common::tPublishOperation<optimized::tCheapCopyPort, typename optimized::tCheapCopyPort::tPublishingDataGlobalBuffer> publish_operation(pointer, cc_port.GetPublishLockCount(push_plan));
+        publish_operation.Execute<false, tChangeStatus::CHANGED, false, false>(cc_port, push_plan);
       }
 #else
       cc_port.Publish(*data_buffer, data_buffer.GetTimestamp());
@@ -40,12 +40,15 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <vector>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/data_ports/api/tPortImplementationTypeTrait.h"
 #include "plugins/data_ports/api/tPortDataPointerImplementation.h"
+#include "plugins/data_ports/common/tLockReleaseBatch.h"
+#include "plugins/data_ports/numeric/tNumber.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -89,6 +92,76 @@ struct tPortBufferReturnCustomization : public tPortImplementation<T, tPortImple
     locked_buffer->locked_buffer.reset();
     return tBase::ToValue(value_buffer);
   }
+
+  /*!
+   * Copies values of all buffers in queue fragment to contiguous storage in one pass.
+   * Locks are released in bulk (see common::tLockReleaseBatch).
+   * Numbers of numeric ports are converted in batches (see numeric::tNumber::ConvertTo()).
+   *
+   * \param fragment Queue fragment (is empty afterwards)
+   * \param result Vector that values are appended to
+   * \param timestamps If not NULL, timestamps are appended to this vector
+   * \return Number of values appended
+   */
+  template <typename TQueueFragment>
+  static size_t AppendAll(TQueueFragment& fragment, std::vector<tPortDataType>& result, std::vector<rrlib::time::tTimestamp>* timestamps)
+  {
+    return AppendAll(fragment, result, timestamps, std::integral_constant < bool, std::is_same<tPortBuffer, numeric::tNumber>::value && (!std::is_same<tPortDataType, numeric::tNumber>::value) > ());
+  }
+
+private:
+
+  /*! Number of numbers that are converted at once in AppendAll() */
+  enum { cCONVERSION_BATCH_SIZE = 64 };
+
+  template <typename TQueueFragment>
+  static size_t AppendAll(TQueueFragment& fragment, std::vector<tPortDataType>& result, std::vector<rrlib::time::tTimestamp>* timestamps, std::true_type convert_numbers)
+  {
+    size_t count = 0;
+    common::tLockReleaseBatch<optimized::tCheapCopyPort> lock_release;
+    numeric::tNumber batch[cCONVERSION_BATCH_SIZE];
+    size_t batch_size = 0;
+    while (!fragment.Empty())
+    {
+      tPortBufferContainerPointer container = fragment.PopFront();
+      optimized::tCheaplyCopiedBufferManager* buffer = container->locked_buffer.release();
+      batch[batch_size++] = buffer->GetObject().template GetData<numeric::tNumber>();
+      if (timestamps)
+      {
+        timestamps->push_back(buffer->GetTimestamp());
+      }
+      lock_release.Add(buffer);
+      count++;
+      if (batch_size == cCONVERSION_BATCH_SIZE || fragment.Empty())
+      {
+        size_t offset = result.size();
+        result.resize(offset + batch_size);
+        numeric::tNumber::ConvertTo(batch, batch_size, &result[offset]);
+        batch_size = 0;
+      }
+    }
+    return count;
+  }
+
+  template <typename TQueueFragment>
+  static size_t AppendAll(TQueueFragment& fragment, std::vector<tPortDataType>& result, std::vector<rrlib::time::tTimestamp>* timestamps, std::false_type convert_numbers)
+  {
+    size_t count = 0;
+    common::tLockReleaseBatch<optimized::tCheapCopyPort> lock_release;
+    while (!fragment.Empty())
+    {
+      tPortBufferContainerPointer container = fragment.PopFront();
+      optimized::tCheaplyCopiedBufferManager* buffer = container->locked_buffer.release();
+      result.push_back(tBase::ToValue(buffer->GetObject().template GetData<tPortBuffer>()));
+      if (timestamps)
+      {
+        timestamps->push_back(buffer->GetTimestamp());
+      }
+      lock_release.Add(buffer);
+      count++;
+    }
+    return count;
+  }
 };
 
 // tPortDataPointer<T> implementation
@@ -118,6 +191,22 @@ struct tPortBufferReturnCustomizationSingleThreaded
   {
     return u.first;
   }
+
+  template <typename TQueue>
+  static size_t AppendAll(TQueue& queue, std::vector<tPortDataType>& result, std::vector<rrlib::time::tTimestamp>* timestamps)
+  {
+    size_t count = queue.size();
+    for (auto it = queue.begin(); it != queue.end(); ++it)
+    {
+      result.push_back(it->first);
+      if (timestamps)
+      {
+        timestamps->push_back(it->second);
+      }
+    }
+    queue.clear();
+    return count;
+  }
 };
 
 // tPortDataPointer<T> implementation
@@ -45,6 +45,7 @@
 //----------------------------------------------------------------------
 #include "plugins/data_ports/api/tPortImplementationTypeTrait.h"
 #include "plugins/data_ports/api/tBoundedPort.h"
+#include "plugins/data_ports/tBufferReuse.h"
 #include "plugins/data_ports/tPortDataPointer.h"
 #include "plugins/data_ports/numeric/tNumber.h"
 #include "plugins/data_ports/optimized/tCheapCopyPort.h"
@@ -190,6 +191,17 @@ struct tPortImplementation : public tCheapCopyPortImplementation<T, TYPE>
 
   static inline void CopyAndPublish(optimized::tCheapCopyPort& port, const T& data, const rrlib::time::tTimestamp& timestamp)
   {
+    if (port.GetInlineCurrentValue())
+    {
+      typename tBase::tPortBuffer value;
+      tBase::Assign(value, data);
+      if (port.TryPublishInline(&value, timestamp))
+      {
+        return;
+      }
+    }
+
+    common::tAllocationMonitor::tPortScope allocation_scope(port);
     optimized::tThreadLocalBufferPools* thread_local_pools = optimized::tThreadLocalBufferPools::Get();
     if (thread_local_pools)
     {
@@ -204,8 +216,10 @@ struct tPortImplementation : public tCheapCopyPortImplementation<T, TYPE>
       typename optimized::tCheapCopyPort::tUnusedManagerPointer buffer(optimized::tGlobalBufferPools::Instance().GetUnusedBuffer(port.GetCheaplyCopyableTypeIndex()).release());
       buffer->SetTimestamp(timestamp);
       tBase::Assign(buffer->GetObject().GetData<typename tBase::tPortBuffer>(), data);
-      common::tPublishOperation<optimized::tCheapCopyPort, typename optimized::tCheapCopyPort::tPublishingDataGlobalBuffer> publish_operation(buffer);
-      publish_operation.Execute<false, tChangeStatus::CHANGED, false, false>(port);
+      standard::tEpochReclamation::tReadGuard epoch_guard;
+      const common::tAbstractDataPort::tPushPlan* push_plan = port.GetPushPlan();
+      common::tPublishOperation<optimized::tCheapCopyPort, typename optimized::tCheapCopyPort::tPublishingDataGlobalBuffer> publish_operation(buffer, port.GetPublishLockCount(push_plan));
+      publish_operation.Execute<false, tChangeStatus::CHANGED, false, false>(port, push_plan);
     }
   }
 
@@ -216,11 +230,11 @@ struct tPortImplementation : public tCheapCopyPortImplementation<T, TYPE>
     result_buffer = tBase::ToValue(temp_buffer);
   }
 
-  static inline tPortDataPointer<const T> GetPointer(optimized::tCheapCopyPort& port)
+  static inline tPortDataPointer<const T> GetPointer(optimized::tCheapCopyPort& port, tStrategy strategy = tStrategy::DEFAULT)
   {
     typename tBase::tPortBuffer buffer;
     rrlib::time::tTimestamp timestamp;
-    port.CopyCurrentValue(buffer, timestamp);
+    port.CopyCurrentValue(buffer, timestamp, strategy);
     return tPortDataPointerImplementation<T, true>(tBase::ToValue(buffer), timestamp);
   }
 
@@ -278,8 +292,9 @@ struct tPortImplementation<T, tPortImplementationType::CHEAP_COPY_SINGLE_THREADE
     port.Publish(data, timestamp);
   }
 
-  static inline tPortDataPointer<const T> GetPointer(tPortBase& port)
+  static inline tPortDataPointer<const T> GetPointer(tPortBase& port, tStrategy strategy = tStrategy::DEFAULT)
   {
+    port.PullValueIfRequired(strategy);
     return tPortDataPointerImplementation<T, true>(port.CurrentValueBuffer());
   }
 
@@ -317,9 +332,27 @@ struct tPortImplementation<T, tPortImplementationType::STANDARD>
 
   static inline void CopyCurrentPortValue(tPortBase& port, T& result_buffer, rrlib::time::tTimestamp& timestamp_buffer)
   {
-    typename standard::tStandardPort::tLockingManagerPointer pointer = port.GetCurrentValueRaw();
-    rrlib::rtti::GenericOperations<T>::DeepCopy(pointer->GetObject().GetData<T>(), result_buffer);
-    timestamp_buffer = pointer->GetTimestamp();
+    port.AccessCurrentValue([&](standard::tPortBufferManager & buffer)
+    {
+      rrlib::rtti::GenericOperations<T>::DeepCopy(buffer.GetObject().GetData<T>(), result_buffer);
+      timestamp_buffer = buffer.GetTimestamp();
+    });
+  }
+
+  static void PrepareBuffer(void* buffer)
+  {
+    tBufferReuse<T>::Prepare(*static_cast<T*>(buffer));
+  }
+
+  static void ResetBuffer(void* buffer)
+  {
+    tBufferReuse<T>::Reset(*static_cast<T*>(buffer));
+  }
+
+  static bool RegisterReuseFunctions(const rrlib::rtti::tType& type)
+  {
+    standard::tPortBufferManager::SetReuseFunctions(type, &PrepareBuffer, &ResetBuffer);
+    return true;
   }
 
   static core::tAbstractPort* CreatePort(tPortCreationInfo<T>& pci)
@@ -328,12 +361,17 @@ struct tPortImplementation<T, tPortImplementationType::STANDARD>
     {
       FINROC_LOG_PRINT_STATIC(WARNING, "Bounds are not supported for type '", pci.data_type.GetName(), "'. Ignoring.");
     }
+    if (tBufferReuse<T>::cCUSTOMIZED)
+    {
+      static bool registered = RegisterReuseFunctions(pci.data_type);
+      (void)registered;
+    }
     return new standard::tStandardPort(pci);
   }
 
-  static inline tPortDataPointer<const T> GetPointer(standard::tStandardPort& port)
+  static inline tPortDataPointer<const T> GetPointer(standard::tStandardPort& port, tStrategy strategy = tStrategy::DEFAULT)
   {
-    auto buffer_pointer = port.GetCurrentValueRaw();
+    auto buffer_pointer = port.GetCurrentValueRaw(strategy);
     return tPortDataPointer<const T>(buffer_pointer, port);
   }
 
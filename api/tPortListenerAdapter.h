@@ -93,6 +93,7 @@ public:
 };
 
 // Adapter base class: chained listener
+// (deprecated: only required for listeners set via tAbstractDataPort::SetPortListener() - ports now call any number of listeners)
 template <typename LISTENER>
 class tPortListenerAdapterBase<LISTENER, false> : public common::tPortListenerRaw
 {
@@ -120,7 +121,7 @@ public:
 };
 
 // Normal adapter class for cheaply copied type
-template <typename LISTENER, typename T, tPortImplementationType TPortImplementationType, bool FIRST_LISTENER>
+template <typename LISTENER, typename T, tPortImplementationType TPortImplementationType, bool FIRST_LISTENER = true>
 class tPortListenerAdapter : public tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>
 {
 public:
@@ -128,8 +129,6 @@ public:
   template <typename ... TArgs>
   tPortListenerAdapter(LISTENER& listener, TArgs& ... args) : tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>(listener, args...) {}
 
-private:
-
   typedef tPortImplementation<T, TPortImplementationType> tImplementation;
 
   virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
@@ -150,8 +149,6 @@ public:
   template <typename ... TArgs>
   tPortListenerAdapter(LISTENER& listener, TArgs& ... args) : tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>(listener, args...) {}
 
-private:
-
   virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
   {
     this->PortChangedRawBase(change_context, lock_counter, value);
@@ -168,8 +165,6 @@ public:
   template <typename ... TArgs>
   tPortListenerAdapter(LISTENER& listener, TArgs& ... args) : tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>(listener, args...) {}
 
-private:
-
   virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
   {
     this->PortChangedRawBase(change_context, lock_counter, value);
@@ -178,7 +173,7 @@ private:
 };
 
 // Normal adapter class for generic port
-template <typename LISTENER, bool FIRST_LISTENER>
+template <typename LISTENER, bool FIRST_LISTENER = true>
 class tPortListenerAdapterGeneric : public tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>
 {
 public:
@@ -186,8 +181,6 @@ public:
   template <typename ... TArgs>
   tPortListenerAdapterGeneric(LISTENER& listener, TArgs& ... args) : tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>(listener, args...) {}
 
-private:
-
   virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
   {
     this->PortChangedRawBase(change_context, lock_counter, value);
@@ -210,7 +203,7 @@ private:
 };
 
 // Variant for smart pointer
-template <typename LISTENER, typename T, bool FIRST_LISTENER>
+template <typename LISTENER, typename T, bool FIRST_LISTENER = true>
 class tPortListenerAdapterForPointer : public tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>
 {
 public:
@@ -218,11 +211,6 @@ public:
   template <typename ... TArgs>
   tPortListenerAdapterForPointer(LISTENER& listener, TArgs& ... args) : tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>(listener, args...) {}
 
-private:
-
-  typedef typename std::conditional<tIsCheaplyCopiedType<T>::value, typename std::conditional<definitions::cSINGLE_THREADED, optimized::tSingleThreadedCheapCopyPortGeneric::tCurrentValueBuffer, optimized::tCheaplyCopiedBufferManager>::type, standard::tPortBufferManager>::type tBufferManager;
-  typedef tPortImplementation<T, tPortImplementationTypeTrait<T>::type> tImplementation;
-
   virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
   {
     this->PortChangedRawBase(change_context, lock_counter, value);
@@ -230,6 +218,11 @@ private:
     PortChangedRawImplementation(change_context, lock_counter, manager);
   }
 
+private:
+
+  typedef typename std::conditional<tIsCheaplyCopiedType<T>::value, typename std::conditional<definitions::cSINGLE_THREADED, optimized::tSingleThreadedCheapCopyPortGeneric::tCurrentValueBuffer, optimized::tCheaplyCopiedBufferManager>::type, standard::tPortBufferManager>::type tBufferManager;
+  typedef tPortImplementation<T, tPortImplementationTypeTrait<T>::type> tImplementation;
+
   inline void PortChangedRawImplementation(tChangeContext& change_context, int& lock_counter, standard::tPortBufferManager& value)
   {
     lock_counter++;
@@ -253,7 +246,7 @@ private:
 };
 
 // Variant for smart pointer with generic port
-template <typename LISTENER, bool FIRST_LISTENER>
+template <typename LISTENER, bool FIRST_LISTENER = true>
 class tPortListenerAdapterGenericForPointer : public tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>
 {
 public:
@@ -261,8 +254,6 @@ public:
   template <typename ... TArgs>
   tPortListenerAdapterGenericForPointer(LISTENER& listener, TArgs& ... args) : tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>(listener, args...) {}
 
-private:
-
   virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
   {
     this->PortChangedRawBase(change_context, lock_counter, value);
@@ -295,7 +286,7 @@ private:
 };
 
 // Simple port adapter
-template <typename LISTENER, bool FIRST_LISTENER>
+template <typename LISTENER, bool FIRST_LISTENER = true>
 class tPortListenerAdapterSimple : public tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>
 {
 public:
@@ -303,8 +294,6 @@ public:
   template <typename ... TArgs>
   tPortListenerAdapterSimple(LISTENER& listener, TArgs& ... args) : tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>(listener, args...) {}
 
-private:
-
   virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
   {
     this->PortChangedRawBase(change_context, lock_counter, value);
@@ -312,6 +301,22 @@ private:
   }
 };
 
+// Adapter for listeners that only count changes (does not access port buffer or create change context)
+template <typename LISTENER, bool FIRST_LISTENER = true>
+class tPortListenerAdapterCounting : public tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>
+{
+public:
+
+  template <typename ... TArgs>
+  tPortListenerAdapterCounting(LISTENER& listener, TArgs& ... args) : tPortListenerAdapterBase<LISTENER, FIRST_LISTENER>(listener, args...) {}
+
+  virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
+  {
+    this->PortChangedRawBase(change_context, lock_counter, value);
+    this->listener.CountChange();
+  }
+};
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -113,6 +113,7 @@ public:
    */
   void CopyCurrentValueToGenericObject(rrlib::rtti::tGenericObject& buffer, rrlib::time::tTimestamp& timestamp, tStrategy strategy = tStrategy::DEFAULT)
   {
+    PullValueIfRequired(strategy);
     timestamp = CurrentValueTimestamp();
     buffer.GetData<T>() = CurrentValue();
   }
@@ -32,12 +32,19 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_set>
+#include "rrlib/thread/tThread.h"
 #include "core/port/tEdgeAggregator.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/data_ports/type_traits.h"
+#include "plugins/data_ports/common/tStartupProfiler.h"
+#include "plugins/data_ports/standard/tEpochReclamation.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -71,22 +78,270 @@ typedef rrlib::thread::tLock tLock;
 // Implementation
 //----------------------------------------------------------------------
 
+namespace internal
+{
+
+/*! Deletion observers (see AddDeletionObserver()) - entries may still be NULL while being added */
+static std::atomic<tAbstractDataPort::tDeletionObserver> deletion_observers[tAbstractDataPort::cMAX_DELETION_OBSERVERS];
+
+/*! Number of (possibly still being added) deletion observers */
+static std::atomic<size_t> deletion_observer_count;
+
+/*!
+ * \return All ports with frozen topology (may only be accessed with structure mutex acquired)
+ */
+static std::vector<tAbstractDataPort*>& FrozenTopologyPorts()
+{
+  static std::vector<tAbstractDataPort*> ports;
+  return ports;
+}
+
+/*! Connection that was changed in bulk-connect mode */
+struct tDeferredConnectionChange
+{
+  /*! Source and destination port of connection (NULL if port was deleted in the meantime) */
+  tAbstractDataPort* source, * destination;
+
+  /*! Was connection created (or removed)? */
+  bool connected;
+};
+
+/*! State of bulk-connect mode (may only be accessed with structure mutex acquired) */
+struct tBulkConnectState
+{
+  /*! Nesting depth of BeginBulkConnect() calls (0 if not in bulk-connect mode) */
+  int depth;
+
+  /*! Connections changed in bulk-connect mode (in the order they were changed) */
+  std::vector<tDeferredConnectionChange> changes;
+
+  /*! Have push plans been discarded in bulk-connect mode? */
+  bool push_plans_discarded;
+
+  /*! Are initial pushes deferred? */
+  bool defer_initial_pushes;
+
+  /*! Deferred initial pushes (in the order they were triggered) */
+  std::vector<tAbstractDataPort::tInitialPush> initial_pushes;
+
+  tBulkConnectState() : depth(0), changes(), push_plans_discarded(false), defer_initial_pushes(false), initial_pushes()
+  {}
+};
+
+/*!
+ * \return State of bulk-connect mode
+ */
+static tBulkConnectState& BulkConnectState()
+{
+  static tBulkConnectState state;
+  return state;
+}
+
+/*! Batch of initial pushes performed by PerformInitialPushes() */
+struct tInitialPushBatch
+{
+  /*! Initial pushes (ports are set to NULL if they are deleted before push is performed) */
+  std::vector<tAbstractDataPort::tInitialPush> initial_pushes;
+
+  /*! Index of next initial push to perform */
+  size_t next;
+
+  /*! Function that performs initial push (source and target port are not NULL) */
+  void (*perform)(const tAbstractDataPort::tInitialPush& initial_push);
+
+  tInitialPushBatch(const std::vector<tAbstractDataPort::tInitialPush>& initial_pushes, void (*perform)(const tAbstractDataPort::tInitialPush&)) :
+    initial_pushes(initial_pushes),
+    next(0),
+    perform(perform)
+  {}
+};
+
+/*! Initial pushes that are currently being performed - so that ports can drop theirs when deleted */
+struct tInitialPushesInProgress
+{
+  /*! Mutex for all variables below */
+  std::mutex mutex;
+
+  /*! Signalled whenever an initial push has been performed */
+  std::condition_variable push_performed;
+
+  /*! Batches that are currently being performed */
+  std::vector<tInitialPushBatch*> batches;
+
+  /*! Source and target ports of initial pushes that are currently running */
+  std::vector<tAbstractDataPort*> busy_ports;
+};
+
+/*!
+ * \return Initial pushes that are currently being performed
+ */
+static tInitialPushesInProgress& InitialPushesInProgress()
+{
+  static tInitialPushesInProgress in_progress;
+  return in_progress;
+}
+
+/*!
+ * Performs initial pushes of batch until there are no more left
+ * (may be called by multiple threads concurrently)
+ *
+ * \param batch Batch of initial pushes
+ */
+static void PerformInitialPushes(tInitialPushBatch& batch)
+{
+  tInitialPushesInProgress& in_progress = InitialPushesInProgress();
+  while (true)
+  {
+    tAbstractDataPort::tInitialPush initial_push;
+    {
+      std::lock_guard<std::mutex> lock(in_progress.mutex);
+      if (batch.next >= batch.initial_pushes.size())
+      {
+        return;
+      }
+      initial_push = batch.initial_pushes[batch.next++];
+      if (!(initial_push.source && initial_push.target))
+      {
+        continue;
+      }
+      in_progress.busy_ports.push_back(initial_push.source);
+      in_progress.busy_ports.push_back(initial_push.target);
+    }
+
+    batch.perform(initial_push);
+
+    std::lock_guard<std::mutex> lock(in_progress.mutex);
+    for (tAbstractDataPort* port : { initial_push.source, initial_push.target })
+    {
+      in_progress.busy_ports.erase(std::find(in_progress.busy_ports.begin(), in_progress.busy_ports.end(), port));
+    }
+    in_progress.push_performed.notify_all();
+  }
+}
+
+/*!
+ * Drops initial pushes of deleted port that have not been performed yet - and waits for running ones to complete
+ *
+ * \param port Port that is deleted
+ */
+static void DropInitialPushes(tAbstractDataPort& port)
+{
+  tInitialPushesInProgress& in_progress = InitialPushesInProgress();
+  std::unique_lock<std::mutex> lock(in_progress.mutex);
+  for (tInitialPushBatch * batch : in_progress.batches)
+  {
+    for (size_t i = batch->next; i < batch->initial_pushes.size(); i++)
+    {
+      tAbstractDataPort::tInitialPush& initial_push = batch->initial_pushes[i];
+      initial_push.source = initial_push.source == &port ? NULL : initial_push.source;
+      initial_push.target = initial_push.target == &port ? NULL : initial_push.target;
+    }
+  }
+  in_progress.push_performed.wait(lock, [&]()
+  {
+    return std::find(in_progress.busy_ports.begin(), in_progress.busy_ports.end(), &port) == in_progress.busy_ports.end();
+  });
+}
+
+/*! Helper thread that performs initial pushes */
+class tInitialPushThread : public rrlib::thread::tThread
+{
+public:
+
+  tInitialPushThread(tInitialPushBatch& batch) :
+    rrlib::thread::tThread("Initial Pushes"),
+    batch(batch)
+  {}
+
+  virtual void Run() override
+  {
+    PerformInitialPushes(batch);
+  }
+
+private:
+
+  /*! Batch of initial pushes to perform */
+  tInitialPushBatch& batch;
+};
+
+}
+
 tAbstractDataPort::tAbstractDataPort(const tAbstractDataPortCreationInfo& create_info) :
   core::tAbstractPort(AdjustPortCreationInfo(create_info)),
   changed(static_cast<int8_t>(tChangeStatus::CHANGED_INITIAL)),
   custom_changed_flag(tChangeStatus::CHANGED_INITIAL),
   strategy(-1),
   min_net_update_time(create_info.min_net_update_interval),
-  port_listener(NULL)
+  port_listeners(NULL),
+  statistics(cCOLLECT_PORT_STATISTICS ? new tPortStatistics() : NULL),
+  pull_cache(),
+  topology_frozen(false),
+  push_plan(NULL),
+  push_destination_count(0),
+  queue_destination_count(0),
+  pull_destination_count(0)
 {
 }
 
 tAbstractDataPort::~tAbstractDataPort()
 {
-  if (port_listener)
+  size_t observer_count = std::min<size_t>(internal::deletion_observer_count.load(std::memory_order_acquire), cMAX_DELETION_OBSERVERS);
+  for (size_t i = 0; i < observer_count; i++)
   {
-    port_listener->PortDeleted();
+    tDeletionObserver observer = internal::deletion_observers[i].load(std::memory_order_acquire);
+    if (observer)
+    {
+      observer(*this);
+    }
   }
+  internal::DropInitialPushes(*this);
+  {
+    tLock lock(GetStructureMutex());
+    if (topology_frozen)
+    {
+      std::vector<tAbstractDataPort*>& frozen_ports = internal::FrozenTopologyPorts();
+      frozen_ports.erase(std::remove(frozen_ports.begin(), frozen_ports.end(), this), frozen_ports.end());
+    }
+    for (internal::tDeferredConnectionChange & change : internal::BulkConnectState().changes)
+    {
+      change.source = change.source == this ? NULL : change.source;
+      change.destination = change.destination == this ? NULL : change.destination;
+    }
+    for (tInitialPush & initial_push : internal::BulkConnectState().initial_pushes)
+    {
+      initial_push.source = initial_push.source == this ? NULL : initial_push.source;
+      initial_push.target = initial_push.target == this ? NULL : initial_push.target;
+    }
+  }
+  delete push_plan.exchange(NULL);
+  std::unique_ptr<tPortListenerTable> listeners(port_listeners.exchange(NULL));
+  if (listeners)
+  {
+    listeners->PortDeleted();
+  }
+}
+
+void tAbstractDataPort::AddDeletionObserver(tDeletionObserver observer)
+{
+  size_t index = internal::deletion_observer_count.fetch_add(1);
+  if (index >= cMAX_DELETION_OBSERVERS)
+  {
+    FINROC_LOG_PRINT_STATIC(ERROR, "Maximum number of deletion observers exceeded. Observer is not added.");
+    return;
+  }
+  internal::deletion_observers[index].store(observer, std::memory_order_release);
+}
+
+void tAbstractDataPort::AddPortListenerRaw(tPortListenerRaw& listener, tPortListenerTable::tDispatchFunction dispatch_function)
+{
+  tLock lock(GetStructureMutex());
+  tPortListenerTable* current_table = port_listeners.load();
+  port_listeners.store(new tPortListenerTable(current_table, listener, dispatch_function), std::memory_order_release);
+  if (current_table)
+  {
+    standard::tEpochReclamation::RetireObject(current_table); // publishing threads might still be using it
+  }
+  UpdatePushPlans(*this); // lock counts of push plans containing this port change
 }
 
 core::tAbstractPortCreationInfo tAbstractDataPort::AdjustPortCreationInfo(const tAbstractDataPortCreationInfo& create_info)
@@ -101,6 +356,162 @@ core::tAbstractPortCreationInfo tAbstractDataPort::AdjustPortCreationInfo(const
   return result;
 }
 
+void tAbstractDataPort::BeginBulkConnect(bool defer_initial_pushes)
+{
+  internal::tBulkConnectState& bulk_connect = internal::BulkConnectState();
+  if (bulk_connect.depth == 0)
+  {
+    bulk_connect.defer_initial_pushes = defer_initial_pushes;
+  }
+  bulk_connect.depth++;
+}
+
+bool tAbstractDataPort::BuildPushPlan(tPushPlan& plan, tAbstractDataPort& port, tAbstractDataPort& origin, bool reverse)
+{
+  if (port.GetFlag(tFlag::NON_STANDARD_ASSIGN))
+  {
+    return false;
+  }
+  size_t index = plan.size();
+  plan.push_back(tPushPlanEntry { &port, &origin, 0 });
+  if (!reverse)
+  {
+    for (auto it = port.OutgoingConnectionsBegin(); it != port.OutgoingConnectionsEnd(); ++it)
+    {
+      tAbstractDataPort& destination_port = static_cast<tAbstractDataPort&>(*it);
+      if (destination_port.WantsPush<false, tChangeStatus::CHANGED>() && (!BuildPushPlan(plan, destination_port, port, false)))
+      {
+        return false;
+      }
+    }
+    for (auto it = port.IncomingConnectionsBegin(); it != port.IncomingConnectionsEnd(); ++it)
+    {
+      tAbstractDataPort& destination_port = static_cast<tAbstractDataPort&>(*it);
+      if (&destination_port != &origin && destination_port.WantsPush<true, tChangeStatus::CHANGED>() && (!BuildPushPlan(plan, destination_port, port, true)))
+      {
+        return false;
+      }
+    }
+  }
+  plan[index].subtree_end = plan.size();
+  return true;
+}
+
+void tAbstractDataPort::ChangeDestinationCount(tAbstractDataPort& source, int16_t destination_strategy, int delta)
+{
+  if (destination_strategy > 1)
+  {
+    source.queue_destination_count += delta;
+  }
+  if (destination_strategy >= 1)
+  {
+    source.push_destination_count += delta;
+  }
+  else if (destination_strategy == 0)
+  {
+    source.pull_destination_count += delta;
+  }
+}
+
+void tAbstractDataPort::CommitBulkConnect(std::vector<tInitialPush>* deferred_initial_pushes)
+{
+  internal::tBulkConnectState& bulk_connect = internal::BulkConnectState();
+  assert(bulk_connect.depth > 0);
+  if (bulk_connect.depth > 1)
+  {
+    bulk_connect.depth--;
+    return;
+  }
+
+  // Propagate strategies and perform initial pushes (still in bulk-connect mode, so that push plans are rebuilt only once)
+  std::vector<internal::tDeferredConnectionChange> changes;
+  std::swap(changes, bulk_connect.changes);
+  for (const internal::tDeferredConnectionChange & change : changes)
+  {
+    if (change.connected && change.source && change.destination)
+    {
+      bool still_connected = false;
+      for (auto it = change.source->OutgoingConnectionsBegin(); it != change.source->OutgoingConnectionsEnd() && (!still_connected); ++it)
+      {
+        still_connected = (&(*it) == change.destination);
+      }
+      if (still_connected)
+      {
+        change.destination->PropagateStrategy(NULL, change.source);
+        change.source->ConsiderInitialReversePush(*change.destination);
+      }
+    }
+    else if (!change.connected)
+    {
+      if (change.destination)
+      {
+        change.destination->PropagateStrategy(NULL, NULL);
+      }
+      if (change.source)
+      {
+        change.source->PropagateStrategy(NULL, NULL);
+      }
+    }
+  }
+
+  bulk_connect.depth = 0;
+  bulk_connect.push_plans_discarded = false;
+  UpdatePushPlans();
+
+  // Only keep last initial push per target and direction (it would overwrite values pushed previously)
+  std::vector<tInitialPush> initial_pushes;
+  std::swap(initial_pushes, bulk_connect.initial_pushes);
+  bulk_connect.defer_initial_pushes = false;
+  if (initial_pushes.empty())
+  {
+    return;
+  }
+  std::unordered_set<tAbstractDataPort*> targets[2];
+  std::vector<tInitialPush> unique_initial_pushes;
+  for (auto it = initial_pushes.rbegin(); it != initial_pushes.rend(); ++it)
+  {
+    if (it->source && it->target && targets[it->reverse ? 1 : 0].insert(it->target).second)
+    {
+      unique_initial_pushes.push_back(*it);
+    }
+  }
+  std::reverse(unique_initial_pushes.begin(), unique_initial_pushes.end());
+  if (deferred_initial_pushes)
+  {
+    deferred_initial_pushes->insert(deferred_initial_pushes->end(), unique_initial_pushes.begin(), unique_initial_pushes.end());
+  }
+  else
+  {
+    PerformInitialPushes(unique_initial_pushes);
+  }
+}
+
+int16_t tAbstractDataPort::ComputeStrategy() const
+{
+  int16_t max = static_cast<int16_t>(std::min(GetStrategyRequirement(), std::numeric_limits<short>::max()));
+  if (queue_destination_count)
+  {
+    for (auto it = OutgoingConnectionsBegin(); it != OutgoingConnectionsEnd(); ++it)
+    {
+      tAbstractDataPort& port = static_cast<tAbstractDataPort&>(*it);
+      max = static_cast<int16_t>(std::max(max, port.GetStrategy()));
+    }
+  }
+  else if (push_destination_count)
+  {
+    max = std::max<int16_t>(max, 1);
+  }
+  else if (pull_destination_count)
+  {
+    max = std::max<int16_t>(max, 0);
+  }
+  if (GetFlag(tFlag::HIJACKED_PORT))
+  {
+    max = -1;
+  }
+  return max;
+}
+
 void tAbstractDataPort::ConsiderInitialReversePush(tAbstractDataPort& target)
 {
   if (IsReady() && target.IsReady())
@@ -108,17 +519,17 @@ void tAbstractDataPort::ConsiderInitialReversePush(tAbstractDataPort& target)
     if (ReversePushStrategy() && CountOutgoingConnections() == 1)
     {
       FINROC_LOG_PRINT(DEBUG_VERBOSE_1, "Performing initial reverse push from ", target.GetQualifiedName(), " to ", GetQualifiedName());
-      target.InitialPushTo(*this, true);
+      target.TriggerInitialPush(*this, true);
     }
   }
 }
 
-void tAbstractDataPort::ForwardStrategy(int16_t strategy2, tAbstractDataPort* push_wanter)
+void tAbstractDataPort::ForwardStrategy(tAbstractDataPort* push_wanter)
 {
   for (auto it = IncomingConnectionsBegin(); it != IncomingConnectionsEnd(); ++it)
   {
     tAbstractDataPort& port = static_cast<tAbstractDataPort&>(*it);
-    if (push_wanter || port.GetStrategy() != strategy2)
+    if (push_wanter || port.ComputeStrategy() != port.GetStrategy())
     {
       port.PropagateStrategy(push_wanter, NULL);
     }
@@ -185,33 +596,55 @@ void tAbstractDataPort::OnConnect(tAbstractPort& partner, bool partner_is_destin
   }
   if (partner_is_destination)
   {
-    (static_cast<tAbstractDataPort&>(partner)).PropagateStrategy(NULL, this);
+    tAbstractDataPort& destination = static_cast<tAbstractDataPort&>(partner);
+    ChangeDestinationCount(*this, destination.strategy, 1);
+    internal::tBulkConnectState& bulk_connect = internal::BulkConnectState();
+    if (bulk_connect.depth)
+    {
+      bulk_connect.changes.push_back({ this, &destination, true });
+    }
+    else
+    {
+      destination.PropagateStrategy(NULL, this);
 
-    // check whether we need an initial reverse push
-    this->ConsiderInitialReversePush(static_cast<tAbstractDataPort&>(partner));
+      // check whether we need an initial reverse push
+      this->ConsiderInitialReversePush(destination);
+    }
   }
+  UpdatePushPlans(*this, static_cast<tAbstractDataPort*>(&partner));
 }
 
 void tAbstractDataPort::OnDisconnect(tAbstractPort& partner, bool partner_is_destination)
 {
   if (partner_is_destination)
   {
+    tAbstractDataPort& destination = static_cast<tAbstractDataPort&>(partner);
+    ChangeDestinationCount(*this, destination.strategy, -1);
     if (!this->IsConnected())
     {
-      this->strategy = -1;
+      this->SetStrategy(-1);
     }
     if (!partner.IsConnected())
     {
-      static_cast<tAbstractDataPort&>(partner).strategy = -1;
+      destination.SetStrategy(-1);
     }
 
-    static_cast<tAbstractDataPort&>(partner).PropagateStrategy(NULL, NULL);
-    this->PropagateStrategy(NULL, NULL);
+    internal::tBulkConnectState& bulk_connect = internal::BulkConnectState();
+    if (bulk_connect.depth)
+    {
+      bulk_connect.changes.push_back({ this, &destination, false });
+    }
+    else
+    {
+      destination.PropagateStrategy(NULL, NULL);
+      this->PropagateStrategy(NULL, NULL);
+    }
   }
   else
   {
     this->OnNetworkConnectionLoss();
   }
+  UpdatePushPlans(*this, static_cast<tAbstractDataPort*>(&partner));
 }
 
 void tAbstractDataPort::OnNetworkConnectionLoss()
@@ -222,21 +655,55 @@ void tAbstractDataPort::OnNetworkConnectionLoss()
   }
 }
 
-bool tAbstractDataPort::PropagateStrategy(tAbstractDataPort* push_wanter, tAbstractDataPort* new_connection_partner)
+void tAbstractDataPort::PerformInitialPushes(const std::vector<tInitialPush>& initial_pushes, unsigned int threads)
 {
-  tLock lock(GetStructureMutex());
+  if (initial_pushes.empty())
+  {
+    return;
+  }
+  internal::tInitialPushesInProgress& in_progress = internal::InitialPushesInProgress();
+  internal::tInitialPushBatch batch(initial_pushes, [](const tInitialPush & initial_push)
+  {
+    if (initial_push.source->IsReady() && initial_push.target->IsReady())
+    {
+      tStartupProfiler::tScope profiler_scope(tStartupPhase::INITIAL_PUSHING, initial_push.target);
+      initial_push.source->InitialPushTo(*initial_push.target, initial_push.reverse);
+    }
+  });
+  {
+    std::lock_guard<std::mutex> lock(in_progress.mutex);
+    in_progress.batches.push_back(&batch);
+  }
 
-  // step1: determine max queue length (strategy) for this port
-  int16_t max = static_cast<int16_t>(std::min(GetStrategyRequirement(), std::numeric_limits<short>::max()));
-  for (auto it = OutgoingConnectionsBegin(); it != OutgoingConnectionsEnd(); ++it)
+#ifndef RRLIB_SINGLE_THREADED
+  threads = static_cast<unsigned int>(std::min<size_t>(threads, initial_pushes.size()));
+  std::vector<std::shared_ptr<rrlib::thread::tThread>> helper_threads;
+  for (unsigned int i = 1; i < threads; i++)
   {
-    tAbstractDataPort& port = static_cast<tAbstractDataPort&>(*it);
-    max = static_cast<int16_t>(std::max(max, port.GetStrategy()));
+    internal::tInitialPushThread* thread = new internal::tInitialPushThread(batch);
+    helper_threads.push_back(thread->GetSharedPtr());
+    thread->Start();
   }
-  if (GetFlag(tFlag::HIJACKED_PORT))
+#endif
+  internal::PerformInitialPushes(batch);
+#ifndef RRLIB_SINGLE_THREADED
+  for (auto & thread : helper_threads)
   {
-    max = -1;
+    thread->Join();
   }
+#endif
+
+  std::lock_guard<std::mutex> lock(in_progress.mutex);
+  in_progress.batches.erase(std::find(in_progress.batches.begin(), in_progress.batches.end(), &batch));
+}
+
+bool tAbstractDataPort::PropagateStrategy(tAbstractDataPort* push_wanter, tAbstractDataPort* new_connection_partner)
+{
+  tLock lock(GetStructureMutex());
+  tStartupProfiler::tScope profiler_scope(tStartupPhase::STRATEGY_PROPAGATION, this);
+
+  // step1: determine max queue length (strategy) for this port
+  int16_t max = ComputeStrategy();
 
   // has max length (strategy) for this port changed? => propagate to sources
   bool change = (max != strategy);
@@ -264,7 +731,7 @@ bool tAbstractDataPort::PropagateStrategy(tAbstractDataPort* push_wanter, tAbstr
       if (IsReady() && push_wanter->IsReady() && (!GetFlag(tFlag::NO_INITIAL_PUSHING)) && (!push_wanter->GetFlag(tFlag::NO_INITIAL_PUSHING)))
       {
         FINROC_LOG_PRINT(DEBUG_VERBOSE_1, "Performing initial push from ", GetQualifiedName(), " to ", push_wanter->GetQualifiedName());
-        InitialPushTo(*push_wanter, false);
+        TriggerInitialPush(*push_wanter, false);
       }
       push_wanter = NULL;
     }
@@ -287,13 +754,14 @@ bool tAbstractDataPort::PropagateStrategy(tAbstractDataPort* push_wanter, tAbstr
   // register strategy change
   if (change)
   {
-    strategy = max;
+    SetStrategy(max);
   }
 
-  ForwardStrategy(strategy, request_push ? this : NULL);  // forward strategy... do it anyway, since new ports may have been connected
+  ForwardStrategy(request_push ? this : NULL);  // forward strategy to sources whose strategy changes - and push wish
 
   if (change)    // do this last to ensure that all relevant strategies have been set, before any network updates occur
   {
+    UpdatePushPlans(*this);
     PublishUpdatedInfo(core::tRuntimeListener::tEvent::CHANGE);
   }
 
@@ -328,6 +796,35 @@ void tAbstractDataPort::SetMinNetUpdateIntervalRaw(int16_t new_interval)
   }
 }
 
+void tAbstractDataPort::SetPortListener(tPortListenerRaw* listener)
+{
+  tLock lock(GetStructureMutex());
+  std::unique_ptr<tPortListenerTable> current_table(port_listeners.load());
+  if (listener)
+  {
+    port_listeners.store(new tPortListenerTable(std::move(current_table), *listener), std::memory_order_release);
+  }
+  else
+  {
+    port_listeners.store(NULL, std::memory_order_release);
+    if (current_table)
+    {
+      standard::tEpochReclamation::RetireObject(current_table.release()); // publishing threads might still be using it
+    }
+  }
+  UpdatePushPlans(*this); // lock counts of push plans containing this port change
+}
+
+void tAbstractDataPort::SetPullCacheWindow(const rrlib::time::tDuration& freshness_window)
+{
+  if (IsReady())
+  {
+    FINROC_LOG_PRINT(ERROR, "Pull cache window may only be set before port is initialized. Ignoring.");
+    return;
+  }
+  pull_cache.reset(freshness_window > rrlib::time::tDuration::zero() ? new tPullCache(freshness_window) : NULL);
+}
+
 void tAbstractDataPort::SetPushStrategy(bool push)
 {
   tLock lock(GetStructureMutex());
@@ -356,14 +853,169 @@ void tAbstractDataPort::SetReversePushStrategy(bool push)
       if (port.IsReady())
       {
         FINROC_LOG_PRINT(DEBUG_VERBOSE_1, "Performing initial reverse push from ", port.GetQualifiedName(), " to ", GetQualifiedName());
-        port.InitialPushTo(*this, true);
+        port.TriggerInitialPush(*this, true);
         break;
       }
     }
   }
+  UpdatePushPlans(*this);
   this->PublishUpdatedInfo(core::tRuntimeListener::tEvent::CHANGE);
 }
 
+void tAbstractDataPort::SetStrategy(int16_t new_strategy)
+{
+  if (new_strategy == strategy)
+  {
+    return;
+  }
+  for (auto it = IncomingConnectionsBegin(); it != IncomingConnectionsEnd(); ++it)
+  {
+    tAbstractDataPort& source = static_cast<tAbstractDataPort&>(*it);
+    ChangeDestinationCount(source, strategy, -1);
+    ChangeDestinationCount(source, new_strategy, 1);
+  }
+  strategy = new_strategy;
+}
+
+void tAbstractDataPort::SetTopologyFrozen(bool frozen)
+{
+  tLock lock(GetStructureMutex());
+  if (frozen == topology_frozen)
+  {
+    return;
+  }
+  topology_frozen = frozen;
+  std::vector<tAbstractDataPort*>& frozen_ports = internal::FrozenTopologyPorts();
+  if (frozen)
+  {
+    frozen_ports.push_back(this);
+  }
+  else
+  {
+    frozen_ports.erase(std::remove(frozen_ports.begin(), frozen_ports.end(), this), frozen_ports.end());
+  }
+  UpdatePushPlan();
+}
+
+void tAbstractDataPort::TriggerInitialPush(tAbstractDataPort& target, bool reverse)
+{
+  internal::tBulkConnectState& bulk_connect = internal::BulkConnectState();
+  if (bulk_connect.depth && bulk_connect.defer_initial_pushes)
+  {
+    bulk_connect.initial_pushes.push_back({ this, &target, reverse });
+  }
+  else
+  {
+    tStartupProfiler::tScope profiler_scope(tStartupPhase::INITIAL_PUSHING, &target);
+    InitialPushTo(target, reverse);
+  }
+}
+
+void tAbstractDataPort::UpdatePushPlan()
+{
+  tPushPlan* new_plan = NULL;
+  if (topology_frozen && internal::BulkConnectState().depth == 0)  // plans are rebuilt when bulk-connect mode ends
+  {
+    new_plan = new tPushPlan();
+    bool usable = true;
+    for (auto it = OutgoingConnectionsBegin(); it != OutgoingConnectionsEnd() && usable; ++it)
+    {
+      tAbstractDataPort& destination_port = static_cast<tAbstractDataPort&>(*it);
+      if (destination_port.WantsPush<false, tChangeStatus::CHANGED>())
+      {
+        usable = BuildPushPlan(*new_plan, destination_port, *this, false);
+      }
+    }
+    if (usable)
+    {
+      new_plan->lock_count = GetAssignLockCount(*this);
+      for (const tPushPlanEntry & entry : *new_plan)
+      {
+        new_plan->lock_count += GetAssignLockCount(*entry.port);
+      }
+    }
+    else
+    {
+      delete new_plan;
+      new_plan = NULL;
+    }
+  }
+
+  tPushPlan* old_plan = push_plan.exchange(new_plan);
+  if (old_plan)
+  {
+    standard::tEpochReclamation::RetireObject(old_plan); // publishing threads might still be using it
+  }
+}
+
+void tAbstractDataPort::UpdatePushPlans()
+{
+  internal::tBulkConnectState& bulk_connect = internal::BulkConnectState();
+  if (bulk_connect.depth && bulk_connect.push_plans_discarded)
+  {
+    return;
+  }
+  bulk_connect.push_plans_discarded = (bulk_connect.depth > 0);
+  for (tAbstractDataPort* port : internal::FrozenTopologyPorts())
+  {
+    port->UpdatePushPlan();
+  }
+}
+
+void tAbstractDataPort::UpdatePushPlans(tAbstractDataPort& changed_port, tAbstractDataPort* other_changed_port)
+{
+  std::vector<tAbstractDataPort*>& frozen_ports = internal::FrozenTopologyPorts();
+  if (frozen_ports.empty())
+  {
+    return;
+  }
+  if (internal::BulkConnectState().depth)
+  {
+    UpdatePushPlans(); // discards all push plans (once) - they are rebuilt when bulk-connect mode ends
+    return;
+  }
+
+  // A port is contained in the push plans of all ports upstream of itself.
+  // It is also a reverse push destination in push plans of all ports upstream of its destinations.
+  std::unordered_set<tAbstractDataPort*> upstream_ports;
+  std::vector<tAbstractDataPort*> ports_to_visit;
+  auto add_port = [&](tAbstractDataPort & port)
+  {
+    if (upstream_ports.insert(&port).second)
+    {
+      ports_to_visit.push_back(&port);
+    }
+  };
+  for (tAbstractDataPort* port : { &changed_port, other_changed_port })
+  {
+    if (port)
+    {
+      add_port(*port);
+      for (auto it = port->OutgoingConnectionsBegin(); it != port->OutgoingConnectionsEnd(); ++it)
+      {
+        add_port(static_cast<tAbstractDataPort&>(*it));
+      }
+    }
+  }
+  while (!ports_to_visit.empty())
+  {
+    tAbstractDataPort* port = ports_to_visit.back();
+    ports_to_visit.pop_back();
+    for (auto it = port->IncomingConnectionsBegin(); it != port->IncomingConnectionsEnd(); ++it)
+    {
+      add_port(static_cast<tAbstractDataPort&>(*it));
+    }
+  }
+
+  for (tAbstractDataPort* port : frozen_ports)
+  {
+    if (upstream_ports.count(port))
+    {
+      port->UpdatePushPlan();
+    }
+  }
+}
+
 void tAbstractDataPort::UpdateEdgeStatistics(tAbstractPort& source, tAbstractPort& target, rrlib::rtti::tGenericObject& data)
 {
   core::tEdgeAggregator::UpdateEdgeStatistics(source, target, data.GetType().GetSize() /* TODO: This is no accurate size estimation for types that allocate memory internally */);
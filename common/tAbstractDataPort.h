@@ -46,7 +46,9 @@
 //----------------------------------------------------------------------
 #include "plugins/data_ports/definitions.h"
 #include "plugins/data_ports/common/tAbstractDataPortCreationInfo.h"
-#include "plugins/data_ports/common/tPortListenerRaw.h"
+#include "plugins/data_ports/common/tPortListenerTable.h"
+#include "plugins/data_ports/common/tPortStatistics.h"
+#include "plugins/data_ports/common/tPullCache.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -79,11 +81,113 @@ public:
 
   tAbstractDataPort(const tAbstractDataPortCreationInfo& create_info);
 
+  /*!
+   * Entry in flattened list of push destinations (see SetTopologyFrozen())
+   */
+  struct tPushPlanEntry
+  {
+    /*! Port that receives value */
+    tAbstractDataPort* port;
+
+    /*! Port that value is received from */
+    tAbstractDataPort* origin;
+
+    /*! Index of first entry after this port's subtree (entries that receive the value via this port) */
+    uint32_t subtree_end;
+  };
+
+  /*! Flattened list of (transitive) push destinations - in the order values are pushed to them */
+  struct tPushPlan : public std::vector<tPushPlanEntry>
+  {
+    /*!
+     * Upper bound for the number of buffer locks a publishing operation along this plan requires
+     * (one for publishing port, one for each destination port, one for each port queue and one for each listener of these ports)
+     */
+    int lock_count;
+
+    tPushPlan() : lock_count(0) {}
+  };
+
+  /*!
+   * Initial push that was deferred (see BeginBulkConnect())
+   */
+  struct tInitialPush
+  {
+    /*! Port whose current value is pushed (NULL if port was deleted in the meantime) */
+    tAbstractDataPort* source;
+
+    /*! Port that receives value (NULL if port was deleted in the meantime) */
+    tAbstractDataPort* target;
+
+    /*! Is this a reverse push? */
+    bool reverse;
+  };
+
+  /*! Function that is called whenever a data port is deleted (see AddDeletionObserver()) */
+  typedef void (*tDeletionObserver)(tAbstractDataPort& port);
+
+  /*!
+   * Number of locks operations add to buffer reference counters that do not derive this number
+   * from the port (e.g. pull operations and initial pushes)
+   */
+  enum { cDEFAULT_PUBLISH_LOCKS = 1000 };
+
+  /*! Upper bound for the number of buffer locks that assigning a value to a (direct) push destination requires - excluding its listeners (assign, enqueue) */
+  enum { cPUSH_DESTINATION_LOCKS = 2 };
+
+  /*! Maximum number of deletion observers (see AddDeletionObserver()) */
+  enum { cMAX_DELETION_OBSERVERS = 8 };
+
+  /*!
+   * Adds function that is called whenever a data port is deleted (at the beginning of the port's destructor).
+   * This way, components of higher layers (e.g. api::tAsyncPullExecutor) can drop references to deleted ports
+   * without this class depending on them.
+   * Observers cannot be removed (at most cMAX_DELETION_OBSERVERS may be added).
+   *
+   * \param observer Function to add
+   */
+  static void AddDeletionObserver(tDeletionObserver observer);
+
+  /*!
+   * Adds listener to port.
+   * Listener is notified via PortDeleted() when port is deleted.
+   *
+   * \param listener Listener to add
+   * \param dispatch_function Function that calls listener on port value changes (default: calls virtual PortChangedRaw())
+   *
+   * Listener is expected to require at most one buffer lock (lock counts in push plans are derived from this)
+   */
+  void AddPortListenerRaw(tPortListenerRaw& listener, tPortListenerTable::tDispatchFunction dispatch_function = &tPortListenerTable::DispatchVirtual);
+
   /*!
    * Set current value to default value
    */
   virtual void ApplyDefaultValue() = 0;
 
+  /*!
+   * Starts bulk-connect mode (calls may be nested; structure mutex must be acquired until matching CommitBulkConnect() - see tBulkConnect).
+   *
+   * While in bulk-connect mode, connecting and disconnecting ports does not propagate strategies and does not perform initial pushes.
+   * This is done once for all changed connections in CommitBulkConnect().
+   * Push plans of ports with frozen topology are not used in the meantime.
+   *
+   * \param defer_initial_pushes Whether initial pushes should be collected instead of being performed when bulk-connect mode ends
+   *                             (only relevant for outermost call - see CommitBulkConnect())
+   */
+  static void BeginBulkConnect(bool defer_initial_pushes = false);
+
+  /*!
+   * Ends bulk-connect mode (see BeginBulkConnect()).
+   * When the outermost call is ended, strategies are propagated and initial pushes are performed for all
+   * connections changed in the meantime (in the order they were changed). Push plans are rebuilt once.
+   *
+   * If initial pushes are deferred, they are collected instead - only the last one per target port and direction is kept.
+   * They can be performed via PerformInitialPushes() - e.g. after structure mutex has been released (see tConnectionTransaction).
+   *
+   * \param deferred_initial_pushes Vector to append deferred initial pushes to (if NULL, they are performed immediately)
+   */
+  static void CommitBulkConnect(std::vector<tInitialPush>* deferred_initial_pushes = NULL);
+
   /*!
    * Forwards current data to specified port (publishes the data via this port)
    *
@@ -141,11 +245,78 @@ public:
   int16_t GetMinNetworkUpdateIntervalForSubscription() const;
 
   /*!
-   * \param listener Listener to remove
+   * \return Listener that calls all of port's listeners (NULL if port has no listeners)
+   *
+   * (deprecated: ports may have any number of listeners - use GetPortListeners() instead.
+   *  Returned listener remains valid as long as it is wrapped by a listener passed to SetPortListener())
+   */
+  __attribute__((deprecated)) inline tPortListenerRaw* GetPortListener()
+  {
+    return port_listeners.load(std::memory_order_acquire);
+  }
+
+  /*!
+   * \param port Port that value is assigned to in publishing operation
+   * \return Upper bound for number of buffer locks that assigning a value to this port requires (assign, enqueue, listeners)
+   */
+  static inline int GetAssignLockCount(const tAbstractDataPort& port)
+  {
+    const tPortListenerTable* listeners = port.GetPortListeners();
+    return 1 + (port.GetFlag(tFlag::HAS_QUEUE) ? 1 : 0) + (listeners ? listeners->LockCount() : 0);
+  }
+
+  /*!
+   * \return Table with port's listeners (NULL if port has no listeners).
+   *         Remains valid while epoch is pinned (see standard::tEpochReclamation::tReadGuard).
+   */
+  inline const tPortListenerTable* GetPortListeners() const
+  {
+    return port_listeners.load(std::memory_order_acquire);
+  }
+
+  /*!
+   * \return Pull cache of this port (NULL if pulled values are not cached - see SetPullCacheWindow())
+   */
+  inline tPullCache* GetPullCache()
+  {
+    return pull_cache.get();
+  }
+
+  /*!
+   * \return Flattened list of push destinations if topology is frozen and list can be used for publishing - otherwise NULL.
+   *         Remains valid while epoch is pinned (see standard::tEpochReclamation::tReadGuard).
+   */
+  inline const tPushPlan* GetPushPlan() const
+  {
+    return push_plan.load(std::memory_order_acquire);
+  }
+
+  /*!
+   * \param push_plan Push plan that publishing operation via this port executes (NULL if it traverses connections)
+   * \return Number of locks that publishing operation needs to add to reference counter of published buffer.
+   *         With push plan, this is exact. Otherwise, it is derived from the number of push destinations (see GetPushDestinationCount()) -
+   *         plus one lock that publishing operation keeps until it has completed. While traversing connections, publishing operations
+   *         add further locks if required (see tPublishOperation::Receive()) - e.g. for ports that forward values.
+   */
+  inline int GetPublishLockCount(const tPushPlan* push_plan) const
+  {
+    return push_plan ? push_plan->lock_count : (GetAssignLockCount(*this) + push_destination_count.load(std::memory_order_relaxed) * cPUSH_DESTINATION_LOCKS + 1);
+  }
+
+  /*!
+   * \return Number of destination ports (outgoing connections) with push strategy
+   */
+  inline uint32_t GetPushDestinationCount() const
+  {
+    return push_destination_count.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \return Snapshot of port's counters (all zero if data_ports::cCOLLECT_PORT_STATISTICS is not set)
    */
-  inline common::tPortListenerRaw* GetPortListener()
+  tPortStatisticsSnapshot GetStatistics() const
   {
-    return port_listener;
+    return statistics ? statistics->GetSnapshot() : tPortStatisticsSnapshot();
   }
 
   /*!
@@ -167,6 +338,39 @@ public:
     return changed != static_cast<int8_t>(tChangeStatus::NO_CHANGE);
   }
 
+  /*!
+   * Increments one of the port's counters
+   * (optimized away completely if data_ports::cCOLLECT_PORT_STATISTICS is not set)
+   *
+   * \param counter Counter to increment
+   * \param amount Amount to add to counter
+   */
+  inline void IncrementCounter(tPortCounter counter, uint64_t amount = 1)
+  {
+    if (cCOLLECT_PORT_STATISTICS)
+    {
+      statistics->Increment(counter, amount);
+    }
+  }
+
+  /*!
+   * \return Has topology been frozen for this port? (see SetTopologyFrozen())
+   */
+  bool IsTopologyFrozen() const
+  {
+    return topology_frozen;
+  }
+
+  /*!
+   * Performs deferred initial pushes (see CommitBulkConnect()).
+   * Initial pushes involving ports that are not ready (anymore) are skipped.
+   * Ports that are deleted concurrently drop their initial pushes (deletion waits for a running push to complete).
+   *
+   * \param initial_pushes Initial pushes to perform
+   * \param threads Number of threads to perform initial pushes with (1 performs all pushes in calling thread - others are helper threads)
+   */
+  static void PerformInitialPushes(const std::vector<tInitialPush>& initial_pushes, unsigned int threads = 1);
+
   /*!
    * \return Is data to this port pushed or pulled?
    */
@@ -193,6 +397,17 @@ public:
     return GetFlag(tFlag::PUSH_STRATEGY_REVERSE);
   }
 
+  /*!
+   * Resets all of port's counters to zero
+   */
+  void ResetStatistics()
+  {
+    if (statistics)
+    {
+      statistics->Reset();
+    }
+  }
+
   /*!
    * \param new_value New value for custom changed flag (for use by custom API - not used/accessed by core port classes.)
    */
@@ -208,14 +423,15 @@ public:
   void SetMinNetUpdateIntervalRaw(int16_t interval);
 
   /*!
-   * \param listener New ports Listener
+   * Replaces all of port's listeners with the specified listener.
+   * Listener is expected to wrap and call the listener returned by GetPortListener() (if any) - or it replaces it.
+   * (warning: this will not delete the old listeners)
    *
-   * (warning: this will not delete the old listener)
+   * (deprecated: use AddPortListenerRaw() - which does not require listeners to call each other)
+   *
+   * \param listener New port listener (NULL removes all listeners)
    */
-  inline void SetPortListener(common::tPortListenerRaw* listener)
-  {
-    port_listener = listener;
-  }
+  __attribute__((deprecated)) void SetPortListener(tPortListenerRaw* listener);
 
   /*!
    * Set whether port is in hijacked mode.
@@ -226,6 +442,16 @@ public:
    */
   void SetHijacked(bool hijacked);
 
+  /*!
+   * Sets freshness window for values pulled from this port's pull request handler.
+   * Pull operations within this window return the last pulled value without invoking the handler again.
+   * Concurrent pull operations on a port with stale value are coalesced into one handler call.
+   * May only be called before port is initialized.
+   *
+   * \param freshness_window Freshness window (zero disables caching - default)
+   */
+  void SetPullCacheWindow(const rrlib::time::tDuration& freshness_window);
+
   /*!
    * Set whether data should be pushed or pulled
    *
@@ -233,6 +459,21 @@ public:
    */
   void SetPushStrategy(bool push);
 
+  /*!
+   * Freeze topology for publishing via this (output) port.
+   *
+   * If topology is frozen, all ports that values published via this port are (transitively) pushed to
+   * are stored in a flat list. Publishing then iterates over this list instead of recursively traversing
+   * connections and checking strategies at every hop.
+   * The list is rebuilt whenever connections or strategies change - so frozen topologies may still be changed
+   * (it is just not efficient to do so frequently).
+   * If any port in the list has non-standard assignment that might modify values (e.g. bounded ports),
+   * the list is not used.
+   *
+   * \param frozen Whether topology should be frozen
+   */
+  void SetTopologyFrozen(bool frozen);
+
   /*!
    * Set whether data should be pushed or pulled in reverse direction
    *
@@ -338,8 +579,29 @@ private:
   /*! Minimum network update interval. Value < 0 means default for this type */
   int16_t min_net_update_time;
 
-  /*! Listener(s) of port value changes */
-  common::tPortListenerRaw* port_listener;
+  /*! Listeners of port value changes (NULL if there are none) - see tPortListenerTable on how table is updated */
+  std::atomic<tPortListenerTable*> port_listeners;
+
+  /*! Port's counters (only allocated if data_ports::cCOLLECT_PORT_STATISTICS is set) */
+  std::unique_ptr<tPortStatistics> statistics;
+
+  /*! Pull cache (only allocated if freshness window was set - see SetPullCacheWindow()) */
+  std::unique_ptr<tPullCache> pull_cache;
+
+  /*! Has topology been frozen for this port? (see SetTopologyFrozen()) */
+  bool topology_frozen;
+
+  /*! Flattened list of push destinations if topology is frozen and list can be used for publishing - otherwise NULL */
+  std::atomic<tPushPlan*> push_plan;
+
+  /*!
+   * Number of destination ports (outgoing connections) with push strategy - with queue (strategy > 1) - and with pull strategy.
+   * Allows computing this port's strategy without iterating over all destination ports (see ComputeStrategy()).
+   * Updated whenever connections or destination strategies change (structure mutex must be acquired).
+   * Publishing threads read push_destination_count without acquiring the mutex (see GetPublishLockCount()).
+   */
+  std::atomic<uint32_t> push_destination_count;
+  uint32_t queue_destination_count, pull_destination_count;
 
 
   /*!
@@ -350,6 +612,33 @@ private:
    */
   static core::tAbstractPortCreationInfo AdjustPortCreationInfo(const tAbstractDataPortCreationInfo& create_info);
 
+  /*!
+   * Adds port and all ports it (transitively) pushes values to to push plan
+   * (recursion mirrors tPublishOperation::Receive)
+   *
+   * \param plan Plan to add ports to
+   * \param port Port that receives value
+   * \param origin Port that value is received from
+   * \param reverse Is value received in reverse direction?
+   * \return False if any of the ports has non-standard assignment that might modify values
+   */
+  static bool BuildPushPlan(tPushPlan& plan, tAbstractDataPort& port, tAbstractDataPort& origin, bool reverse);
+
+  /*!
+   * Adjusts destination counters of source port (see push_destination_count)
+   *
+   * \param source Source port
+   * \param destination_strategy Strategy of destination port
+   * \param delta Amount to add to counter (+1 for added destinations, -1 for removed destinations)
+   */
+  static void ChangeDestinationCount(tAbstractDataPort& source, int16_t destination_strategy, int delta);
+
+  /*!
+   * \return Strategy this port should have - given its current connections and destination strategies
+   * (Called in runtime-registry synchronized context only)
+   */
+  int16_t ComputeStrategy() const;
+
   /*!
    * Should be called in situations where there might need to be an initial push
    * (e.g. connecting or strategy change)
@@ -359,12 +648,11 @@ private:
   void ConsiderInitialReversePush(tAbstractDataPort& target);
 
   /*!
-   * Forward current strategy to source ports (helper for above - and possibly variations of above)
+   * Forward current strategy to source ports whose strategy changes as a consequence (helper for above - and possibly variations of above)
    *
-   * \param strategy New Strategy of this port
    * \param push_wanter Port that "wants" an initial push and from whom this call originates - null if there's no port that wants as push
    */
-  void ForwardStrategy(int16_t strategy, tAbstractDataPort* push_wanter);
+  void ForwardStrategy(tAbstractDataPort* push_wanter);
 
   /*!
    * \return Maximum queue length
@@ -391,6 +679,44 @@ private:
   virtual void OnDisconnect(tAbstractPort& partner, bool partner_is_destination) override;
 
   virtual void OnNetworkConnectionLoss() override;
+
+  /*!
+   * Pushes current value to target port - or defers this (see BeginBulkConnect())
+   * (structure mutex must be acquired)
+   *
+   * \param target Port to push data to
+   * \param reverse Is this a reverse push?
+   */
+  void TriggerInitialPush(tAbstractDataPort& target, bool reverse);
+
+  /*!
+   * Sets strategy of this port and updates destination counters of source ports accordingly
+   * (structure mutex must be acquired)
+   *
+   * \param new_strategy New strategy
+   */
+  void SetStrategy(int16_t new_strategy);
+
+  /*!
+   * Rebuilds push plans of all ports with frozen topology
+   * (structure mutex must be acquired)
+   */
+  static void UpdatePushPlans();
+
+  /*!
+   * Rebuilds push plans of ports with frozen topology that might contain the changed port(s)
+   * (called whenever connections, strategies or listeners change; structure mutex must be acquired)
+   *
+   * \param changed_port Port whose connections, strategy or listeners changed
+   * \param other_changed_port Another port whose connections changed (optional)
+   */
+  static void UpdatePushPlans(tAbstractDataPort& changed_port, tAbstractDataPort* other_changed_port = NULL);
+
+  /*!
+   * Rebuilds push plan of this port
+   * (structure mutex must be acquired)
+   */
+  void UpdatePushPlan();
 };
 
 //----------------------------------------------------------------------
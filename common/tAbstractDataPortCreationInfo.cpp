@@ -70,6 +70,7 @@ namespace common
 
 tAbstractDataPortCreationInfo::tAbstractDataPortCreationInfo() :
   max_queue_size(-1),
+  queue_ring_buffer(false),
   min_net_update_interval(-1),
   config_entry(),
   default_value(),
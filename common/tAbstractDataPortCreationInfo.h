@@ -86,6 +86,9 @@ public:
   /*! Input Queue size; value <= 0 means flexible size */
   int max_queue_size;
 
+  /*! Use ring buffer for bounded FIFO input queue while port has a single source? */
+  bool queue_ring_buffer;
+
   /*! Minimum Network update interval; value < 0 => default values */
   int16_t min_net_update_interval;
 
@@ -134,6 +137,7 @@ public:
   void Set(const tQueueSettings& queue_settings)
   {
     max_queue_size = queue_settings.GetMaximumQueueLength();
+    queue_ring_buffer = queue_settings.RingBufferForSingleSource();
     flags |= core::tFrameworkElement::tFlag::HAS_QUEUE | core::tFrameworkElement::tFlag::USES_QUEUE;
     if (queue_settings.DequeueAllQueue())
     {
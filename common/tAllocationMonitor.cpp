@@ -0,0 +1,128 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tAllocationMonitor.cpp
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/data_ports/common/tAllocationMonitor.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "core/log_messages.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Names of allocation sites (index is tAllocationSite) */
+static const char* cALLOCATION_SITE_NAMES[] = { "port buffer", "queue container", "buffer pool" };
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+std::atomic<bool> tAllocationMonitor::system_started(false);
+std::atomic<tAllocationPolicy> tAllocationMonitor::policy(tAllocationPolicy::LOG);
+std::atomic<size_t> tAllocationMonitor::allocation_counts[static_cast<size_t>(tAllocationSite::DIMENSION)];
+__thread const core::tFrameworkElement* tAllocationMonitor::current_port = NULL;
+
+size_t tAllocationMonitor::GetTotalAllocationCount()
+{
+  size_t result = 0;
+  for (size_t i = 0; i < static_cast<size_t>(tAllocationSite::DIMENSION); i++)
+  {
+    result += allocation_counts[i].load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+void tAllocationMonitor::HandleAllocation(tAllocationSite site, const rrlib::rtti::tType& data_type, const core::tFrameworkElement* port)
+{
+  allocation_counts[static_cast<size_t>(site)].fetch_add(1, std::memory_order_relaxed);
+  tAllocationPolicy current_policy = GetPolicy();
+  if (current_policy == tAllocationPolicy::COUNT)
+  {
+    return;
+  }
+
+  port = port ? port : current_port;
+  if (port)
+  {
+    FINROC_LOG_PRINT_STATIC(WARNING, "Allocated ", cALLOCATION_SITE_NAMES[static_cast<size_t>(site)], " of type ", data_type.GetName(), " in port ", port->GetQualifiedName(), " after system was started");
+  }
+  else
+  {
+    FINROC_LOG_PRINT_STATIC(WARNING, "Allocated ", cALLOCATION_SITE_NAMES[static_cast<size_t>(site)], " of type ", data_type.GetName(), " after system was started");
+  }
+  if (current_policy == tAllocationPolicy::ABORT)
+  {
+    FINROC_LOG_PRINT_STATIC(ERROR, "Allocation after system start is not allowed. Aborting.");
+    abort();
+  }
+}
+
+void tAllocationMonitor::ResetCounts()
+{
+  for (size_t i = 0; i < static_cast<size_t>(tAllocationSite::DIMENSION); i++)
+  {
+    allocation_counts[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,243 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tAllocationMonitor.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tAllocationMonitor
+ *
+ * \b tAllocationMonitor
+ *
+ * Detects heap allocations on the data path after the system has been started.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__common__tAllocationMonitor_h__
+#define __plugins__data_ports__common__tAllocationMonitor_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include "rrlib/rtti/rtti.h"
+#include "core/tFrameworkElement.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/common/tStartupProfiler.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Places on data path where memory may be allocated */
+enum class tAllocationSite
+{
+  PORT_BUFFER,      //!< New port buffer was created, because buffer pool was empty (includes reserving memory for strings)
+  QUEUE_CONTAINER,  //!< New container for an input queue was created, because container pool was empty
+  BUFFER_POOL,      //!< New buffer pool was created in multi-type buffer pool
+  DIMENSION
+};
+
+/*! What to do when memory is allocated after the system has been started */
+enum class tAllocationPolicy
+{
+  COUNT,  //!< Only count allocations
+  LOG,    //!< Count and log allocations (with port name - if known)
+  ABORT   //!< Count and log allocations - then abort program
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Monitor for allocations on data path
+/*!
+ * Real-time applications should not allocate memory after initialization.
+ * Buffer pools and queues of data ports allocate memory when they run out of buffers, though.
+ *
+ * Once SetSystemStarted(true) has been called (the "system started" barrier), every such allocation
+ * is counted - and handled as specified by the current tAllocationPolicy.
+ * Before the barrier, allocations are not monitored at all.
+ *
+ * In order to avoid allocations after the barrier, enough buffers should be provisioned up front:
+ * optimized::tGlobalBufferPools::PrewarmAllNumaNodes() (and tThreadLocalBufferManagement::PrewarmPools()) for 'cheaply copied' types,
+ * standard::tStandardPort::ProvisionBuffers() for other types.
+ * Queues of ports with bounded queue length provision their containers on construction.
+ */
+class tAllocationMonitor
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * Sets port that is processed by the current thread while the object exists.
+   * Allows to report port name on allocations (only when system has been started).
+   */
+  class tPortScope
+  {
+  public:
+    tPortScope(const core::tFrameworkElement& port) :
+      active(IsSystemStarted()),
+      previous_port(NULL)
+    {
+      if (active)
+      {
+        previous_port = current_port;
+        current_port = &port;
+      }
+    }
+
+    ~tPortScope()
+    {
+      if (active)
+      {
+        current_port = previous_port;
+      }
+    }
+
+  private:
+
+    /*! Was port set? */
+    const bool active;
+
+    /*! Port that was set before */
+    const core::tFrameworkElement* previous_port;
+  };
+
+  /*!
+   * \param site Allocation site
+   * \return Number of allocations at specified site after system was started
+   */
+  static size_t GetAllocationCount(tAllocationSite site)
+  {
+    return allocation_counts[static_cast<size_t>(site)].load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \return Current allocation policy
+   */
+  static tAllocationPolicy GetPolicy()
+  {
+    return policy.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \return Number of allocations at all sites after system was started
+   */
+  static size_t GetTotalAllocationCount();
+
+  /*!
+   * \return True if system has been started (allocations are monitored)
+   */
+  static inline bool IsSystemStarted()
+  {
+    return system_started.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * Called by data ports whenever memory is allocated on data path
+   *
+   * \param site Allocation site
+   * \param data_type Data type of allocated buffer
+   * \param port Port that allocates memory (NULL if unknown - then the port set via tPortScope is reported)
+   */
+  static inline void ReportAllocation(tAllocationSite site, const rrlib::rtti::tType& data_type, const core::tFrameworkElement* port = NULL)
+  {
+    tStartupProfiler::CountAllocation();
+    if (IsSystemStarted())
+    {
+      HandleAllocation(site, data_type, port);
+    }
+  }
+
+  /*!
+   * Resets all allocation counters to zero
+   */
+  static void ResetCounts();
+
+  /*!
+   * \param new_policy What to do when memory is allocated after the system has been started
+   */
+  static void SetPolicy(tAllocationPolicy new_policy)
+  {
+    policy.store(new_policy, std::memory_order_relaxed);
+  }
+
+  /*!
+   * Sets or resets the "system started" barrier.
+   * Allocations on data path are monitored while the system is started.
+   *
+   * \param started Has system been started?
+   */
+  static void SetSystemStarted(bool started)
+  {
+    system_started.store(started, std::memory_order_relaxed);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Has system been started? */
+  static std::atomic<bool> system_started;
+
+  /*! Current allocation policy */
+  static std::atomic<tAllocationPolicy> policy;
+
+  /*! Allocation counters (index is tAllocationSite) */
+  static std::atomic<size_t> allocation_counts[static_cast<size_t>(tAllocationSite::DIMENSION)];
+
+  /*! Port processed by current thread (see tPortScope) */
+  static __thread const core::tFrameworkElement* current_port;
+
+  /*!
+   * Counts and handles allocation after system has been started
+   */
+  static void HandleAllocation(tAllocationSite site, const rrlib::rtti::tType& data_type, const core::tFrameworkElement* port);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
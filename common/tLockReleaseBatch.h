@@ -0,0 +1,184 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tLockReleaseBatch.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tLockReleaseBatch
+ *
+ * \b tLockReleaseBatch
+ *
+ * Accumulates buffer locks that are to be released - and releases them in bulk.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__common__tLockReleaseBatch_h__
+#define __plugins__data_ports__common__tLockReleaseBatch_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Batch of lock releases
+/*!
+ * When many locked buffers are processed at once (e.g. all elements of a queue fragment),
+ * releasing every lock separately requires one atomic operation per element
+ * (or, for thread-local buffers of other threads, one atomic operation on the origin's counter).
+ *
+ * This class groups lock releases by buffer manager: Locks on the same buffer are counted
+ * and released with a single operation when the batch is flushed.
+ * Buffers in a batch belong to different - typically few - publishing operations,
+ * so a small number of slots suffices (the batch is flushed when all slots are occupied).
+ *
+ * Locks are released on Flush() and on destruction.
+ *
+ * \tparam TPortBase Port backend (tCheapCopyPort or tStandardPort - provides static ReleaseLocks(buffer, lock_count))
+ * \tparam Tslots Number of different buffers that can be accumulated before batch is flushed
+ */
+template <typename TPortBase, size_t Tslots = 8>
+class tLockReleaseBatch : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Buffer manager type of port backend */
+  typedef typename TPortBase::tLockingManagerPointer::element_type tBufferManager;
+
+  tLockReleaseBatch() :
+    entry_count(0)
+  {}
+
+  ~tLockReleaseBatch()
+  {
+    Flush();
+  }
+
+  /*!
+   * Adds lock to release
+   *
+   * \param buffer Buffer to release a lock of (this batch takes over lock)
+   */
+  void Add(tBufferManager* buffer)
+  {
+    for (size_t i = 0; i < entry_count; i++)
+    {
+      if (entries[i].buffer == buffer)
+      {
+        entries[i].lock_count++;
+        return;
+      }
+    }
+    if (entry_count == Tslots)
+    {
+      Flush();
+    }
+    entries[entry_count].buffer = buffer;
+    entries[entry_count].lock_count = 1;
+    entry_count++;
+  }
+
+  /*!
+   * Releases all accumulated locks
+   */
+  void Flush()
+  {
+    for (size_t i = 0; i < entry_count; i++)
+    {
+      TPortBase::ReleaseLocks(entries[i].buffer, entries[i].lock_count);
+    }
+    entry_count = 0;
+  }
+
+  /*!
+   * Removes all elements from queue fragment and adds their locks to this batch.
+   * Queue containers are recycled.
+   *
+   * \param fragment Queue fragment with locked buffers (is empty afterwards)
+   */
+  template <typename TQueueFragment>
+  void ReleaseAll(TQueueFragment& fragment)
+  {
+    while (!fragment.Empty())
+    {
+      typename TPortBase::tPortBufferContainerPointer container = fragment.PopAny();
+      if (container->locked_buffer)
+      {
+        Add(container->locked_buffer.release());
+      }
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Buffer with accumulated locks */
+  struct tEntry
+  {
+    tBufferManager* buffer;
+    int lock_count;
+  };
+
+  /*! Buffers with accumulated locks */
+  tEntry entries[Tslots];
+
+  /*! Number of used entries */
+  size_t entry_count;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -39,6 +39,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <atomic>
 #include "rrlib/buffer_pools/tBufferPool.h"
 #include "rrlib/rtti/rtti.h"
 #include "core/definitions.h"
@@ -48,6 +49,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/data_ports/common/tAbstractPortBufferManager.h"
+#include "plugins/data_ports/common/tAllocationMonitor.h"
 #include "plugins/data_ports/optimized/cheaply_copied_types.h"
 
 //----------------------------------------------------------------------
@@ -121,12 +123,17 @@ public:
    * \param intial_size Number of buffer to allocate initially
    */
   tPortBufferPool(const rrlib::rtti::tType& data_type, int initial_size) :
-    buffer_pool()
+    buffer_pool(),
+    allocated_buffers(0),
+    misses(0)
   {
     AllocateAdditionalBuffers(data_type, initial_size);
   }
 
-  tPortBufferPool() : buffer_pool()
+  tPortBufferPool() :
+    buffer_pool(),
+    allocated_buffers(0),
+    misses(0)
   {}
 
   /*!
@@ -151,6 +158,22 @@ public:
 //    return data_type;
 //  }
 
+  /*!
+   * \return Number of buffers that have been allocated for this pool (including buffers currently in use)
+   */
+  size_t GetAllocatedBufferCount() const
+  {
+    return allocated_buffers.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \return Number of times an unused buffer was requested but none was available - so that a buffer had to be allocated
+   */
+  size_t GetMissCount() const
+  {
+    return misses.load(std::memory_order_relaxed);
+  }
+
   /*!
    * \param cheaply_copyable_type_index Index of 'cheaply copied' data type of pool
    * \return Returns unused buffer. If there are no buffers that can be reused, a new buffer is allocated.
@@ -162,7 +185,10 @@ public:
     {
       return std::move(buffer);
     }
-    return CreateBuffer(optimized::GetType(cheaply_copyable_type_index));
+    misses.fetch_add(1, std::memory_order_relaxed);
+    rrlib::rtti::tType data_type = optimized::GetType(cheaply_copyable_type_index);
+    tAllocationMonitor::ReportAllocation(tAllocationSite::PORT_BUFFER, data_type);
+    return CreateBuffer(data_type);
   }
 
   /*!
@@ -177,7 +203,13 @@ public:
     {
       return std::move(buffer);
     }
-    return possibly_create_buffer ? CreateBuffer(data_type) : tPointer();
+    if (!possibly_create_buffer)
+    {
+      return tPointer();
+    }
+    misses.fetch_add(1, std::memory_order_relaxed);
+    tAllocationMonitor::ReportAllocation(tAllocationSite::PORT_BUFFER, data_type);
+    return CreateBuffer(data_type);
   }
 
   /*!
@@ -188,6 +220,14 @@ public:
     return buffer_pool.InternalBufferManagement();
   }
 
+  /*!
+   * Resets miss counter to zero
+   */
+  void ResetMissCount()
+  {
+    misses.store(0, std::memory_order_relaxed);
+  }
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -199,6 +239,12 @@ private:
   /*! Wrapped buffer pool */
   tBufferPool buffer_pool;
 
+  /*! Number of buffers allocated for this pool */
+  std::atomic<size_t> allocated_buffers;
+
+  /*! Number of times GetUnusedBuffer() had to allocate a new buffer */
+  std::atomic<size_t> misses;
+
 
   /*
    * \param data_type Data type of buffers in this pool
@@ -206,14 +252,8 @@ private:
    */
   tPointer CreateBuffer(const rrlib::rtti::tType& data_type)
   {
-    std::unique_ptr<TBufferManager> new_buffer(TBufferManager::CreateInstance(data_type));
-
-    // In case we have a string: allocate a certain buffer size (for RT capabilities with smaller payload) -
-    // We do not need this check for 'cheaply copied' types - therefore the concurrency condition
-    if (CONCURRENCY != rrlib::concurrent_containers::tConcurrency::NONE && new_buffer->GetObject().GetType().GetRttiName() == typeid(tString).name())
-    {
-      static_cast<rrlib::rtti::tGenericObject&>(new_buffer->GetObject()).GetData<tString>().reserve(512);  // TODO: move to parameter in some config.h
-    }
+    std::unique_ptr<TBufferManager> new_buffer(TBufferManager::CreateInstance(data_type));  // buffer managers prepare buffers of customized types (see tBufferReuse)
+    allocated_buffers.fetch_add(1, std::memory_order_relaxed);
     return buffer_pool.AddBuffer(std::move(new_buffer));
   }
 
@@ -0,0 +1,236 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tPortListenerTable.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tPortListenerTable
+ *
+ * \b tPortListenerTable
+ *
+ * Immutable table of a port's listeners.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__common__tPortListenerTable_h__
+#define __plugins__data_ports__common__tPortListenerTable_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <memory>
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/common/tPortListenerRaw.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Table of port listeners
+/*!
+ * Compact array of a port's listeners - each with a function that calls it.
+ * On publishing, listeners are called in a single loop over this array
+ * (the change context is created only once).
+ *
+ * Tables are never modified after they have been published at a port (read-copy-update):
+ * Adding a listener creates a new table that replaces the current one.
+ * As publishing threads may still iterate over a replaced table, it is retired
+ * via standard::tEpochReclamation (the same way as replaced push plans).
+ *
+ * A table is also a raw port listener itself (calling all listeners it contains).
+ * This way, it can be wrapped by listeners set via the deprecated tAbstractDataPort::SetPortListener().
+ */
+class tPortListenerTable : public tPortListenerRaw
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Function that calls listener */
+  typedef void (*tDispatchFunction)(tPortListenerRaw& listener, tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value);
+
+  /*!
+   * Dispatch function for listeners of type TListener.
+   * Calls TListener::PortChangedRaw() directly - without virtual function call
+   * (TListener must override PortChangedRaw()).
+   */
+  template <typename TListener>
+  static void DispatchTo(tPortListenerRaw& listener, tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value)
+  {
+    static_cast<TListener&>(listener).TListener::PortChangedRaw(change_context, lock_counter, value);
+  }
+
+  /*!
+   * Dispatch function for listeners whose type is not known (virtual function call)
+   */
+  static void DispatchVirtual(tPortListenerRaw& listener, tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value)
+  {
+    listener.PortChangedRaw(change_context, lock_counter, value);
+  }
+
+  /*!
+   * Creates table with all listeners from 'current_table' - plus the new listener
+   *
+   * \param current_table Current table (may be NULL). It is not modified and needs to be retired by the caller.
+   * \param listener Listener to add
+   * \param dispatch_function Function that calls listener
+   */
+  tPortListenerTable(const tPortListenerTable* current_table, tPortListenerRaw& listener, tDispatchFunction dispatch_function) :
+    size(current_table ? current_table->size + 1 : 1),
+    lock_count(current_table ? current_table->lock_count + 1 : 1),
+    entries(new tEntry[size]),
+    wrapped_table(current_table ? current_table->wrapped_table : std::shared_ptr<tPortListenerTable>())
+  {
+    for (size_t i = 0; i + 1 < size; i++)
+    {
+      entries[i] = current_table->entries[i];
+    }
+    entries[size - 1].dispatch_function = dispatch_function;
+    entries[size - 1].listener = &listener;
+  }
+
+  /*!
+   * Creates table with a single listener that replaces all listeners in 'replaced_table'
+   * (listener is expected to wrap 'replaced_table' - as required by deprecated tAbstractDataPort::SetPortListener())
+   *
+   * \param replaced_table Replaced table (may be NULL). New table takes ownership, as listener might call it.
+   * \param listener New listener
+   */
+  tPortListenerTable(std::unique_ptr<tPortListenerTable> && replaced_table, tPortListenerRaw& listener) :
+    size(1),
+    lock_count(replaced_table ? replaced_table->lock_count + 1 : 1),
+    entries(new tEntry[1]),
+    wrapped_table(std::move(replaced_table))
+  {
+    entries[0].dispatch_function = &DispatchVirtual;
+    entries[0].listener = &listener;
+  }
+
+  /*!
+   * Calls all listeners in table
+   *
+   * \param change_context Context information on port buffer change
+   * \param lock_counter Lock counter (see tPortListenerRaw::PortChangedRaw())
+   * \param value Base class of manager of port's new value
+   */
+  inline void Dispatch(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) const
+  {
+    for (const tEntry * entry = entries.get(), * end = entries.get() + size; entry != end; ++entry)
+    {
+      entry->dispatch_function(*entry->listener, change_context, lock_counter, value);
+    }
+  }
+
+  /*!
+   * \return Maximum number of buffer locks that listeners in this table require
+   */
+  size_t LockCount() const
+  {
+    return lock_count;
+  }
+
+  virtual void PortChangedRaw(tChangeContext& change_context, int& lock_counter, rrlib::buffer_pools::tBufferManagementInfo& value) override
+  {
+    Dispatch(change_context, lock_counter, value);
+  }
+
+  /*!
+   * Notifies all listeners in table that port is deleted
+   * (table itself is not deleted - it is owned by port or by the table that wraps it)
+   */
+  virtual void PortDeleted() override
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      entries[i].listener->PortDeleted();
+    }
+  }
+
+  /*!
+   * \return Number of listeners in table
+   */
+  size_t Size() const
+  {
+    return size;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Entry in table */
+  struct tEntry
+  {
+    /*! Function that calls listener */
+    tDispatchFunction dispatch_function;
+
+    /*! Listener */
+    tPortListenerRaw* listener;
+  };
+
+  /*! Number of listeners in table */
+  const size_t size;
+
+  /*! Maximum number of buffer locks that listeners in this table require (wrapped listeners included) */
+  const size_t lock_count;
+
+  /*! Listeners */
+  std::unique_ptr<tEntry[]> entries;
+
+  /*!
+   * Table wrapped by a listener set via deprecated tAbstractDataPort::SetPortListener() (NULL if there is none).
+   * Shared by all tables that contain this listener.
+   */
+  std::shared_ptr<tPortListenerTable> wrapped_table;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
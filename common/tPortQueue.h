@@ -43,6 +43,9 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/common/tAbstractDataPort.h"
+#include "plugins/data_ports/common/tAllocationMonitor.h"
+#include "plugins/data_ports/common/tSingleProducerRingBuffer.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -65,6 +68,13 @@ namespace common
 /*!
  * Queue for incoming port values - used in input ports.
  *
+ * Bounded FIFO queues can additionally use a tSingleProducerRingBuffer that stores locked buffers in place.
+ * It is used while the port has at most one source (incoming connection) - otherwise values are
+ * enqueued in the concurrent queue. Only one of the two containers is used at a time:
+ * When the number of sources changes, the values are moved to the other container (see UpdateSourceCount()).
+ * Enqueue and dequeue operations wait while this is done - so values remain in order and
+ * the queue never contains more than its maximum number of elements.
+ *
  * \tparam TLockingPointer Unique pointer to port buffer that unlocks buffer on release
  */
 template <typename TLockingPointer>
@@ -94,9 +104,23 @@ public:
   /*! Buffer container pointer */
   typedef typename tPortBufferContainerPool::tPointer tPortBufferContainerPointer;
 
-  tPortQueue(bool fifo_queue) :
+  /*!
+   * \param fifo_queue Create FIFO queue? (otherwise dequeue-all queue is created)
+   * \param owner Port that owns queue
+   * \param use_ring_buffer Use ring buffer while port has a single source? (only relevant for bounded FIFO queues)
+   */
+  tPortQueue(bool fifo_queue, const tAbstractDataPort& owner, bool use_ring_buffer = false) :
     port_buffer_container_pool(),
-    fifo_queue(fifo_queue)
+    fifo_queue(fifo_queue),
+    approximate_length(0),
+    owner(owner),
+    provisioned_containers(0),
+    use_ring_buffer(use_ring_buffer && fifo_queue),
+    ring_buffer(),
+    source_count(0),
+    ring_buffer_active(false),
+    switching_container(false),
+    active_operations(0)
   {
     if (fifo_queue)
     {
@@ -126,8 +150,20 @@ public:
   TLockingPointer Dequeue()
   {
     assert(fifo_queue);
-    tPortBufferContainerPointer ptr = queue_fifo->Dequeue();
-    return ptr ? std::move(ptr->locked_buffer) : TLockingPointer();
+    if (!ring_buffer)
+    {
+      return DequeueFromFifoQueue();
+    }
+
+    EnterOperation();
+    bool from_ring_buffer = ring_buffer_active.load(std::memory_order_relaxed);
+    TLockingPointer result = from_ring_buffer ? ring_buffer->Dequeue() : DequeueFromFifoQueue();
+    if (cCOLLECT_PORT_STATISTICS && result && from_ring_buffer)
+    {
+      approximate_length.fetch_sub(1, std::memory_order_relaxed);
+    }
+    ExitOperation();
+    return result;
   }
 
   /*!
@@ -136,28 +172,42 @@ public:
   rrlib::concurrent_containers::tQueueFragment<tPortBufferContainerPointer> DequeueAll()
   {
     assert(!fifo_queue);
+    if (cCOLLECT_PORT_STATISTICS)
+    {
+      approximate_length.store(0, std::memory_order_relaxed);
+    }
     return queue_all->DequeueAll();
   }
 
   /*!
    * Enqueue locked buffer in queue
+   *
+   * \return True if queue was full, so that the oldest element was discarded.
+   *         (only determined - approximately - if data_ports::cCOLLECT_PORT_STATISTICS is set; false otherwise)
    */
-  void Enqueue(TLockingPointer && pointer)
+  bool Enqueue(TLockingPointer && pointer)
   {
-    tPortBufferContainerPointer container_pointer = port_buffer_container_pool.GetUnusedBuffer();
-    if (!container_pointer)
+    if (!ring_buffer)
     {
-      container_pointer = port_buffer_container_pool.AddBuffer(std::unique_ptr<tPortBufferContainer>(new tPortBufferContainer()));
+      return EnqueueInQueue(std::move(pointer));
     }
-    container_pointer->locked_buffer = std::move(pointer);
-    if (fifo_queue)
+
+    EnterOperation();
+    bool discarded = false;
+    if (ring_buffer_active.load(std::memory_order_relaxed))
     {
-      queue_fifo->Enqueue(container_pointer);
+      discarded = ring_buffer->Enqueue(std::move(pointer));
+      if (cCOLLECT_PORT_STATISTICS && (!discarded))
+      {
+        approximate_length.fetch_add(1, std::memory_order_relaxed);
+      }
     }
     else
     {
-      queue_all->Enqueue(container_pointer);
+      discarded = EnqueueInQueue(std::move(pointer));
     }
+    ExitOperation();
+    return discarded;
   }
 
   int GetMaxQueueLength()
@@ -165,6 +215,13 @@ public:
     return fifo_queue ? queue_fifo->GetMaxLength() : queue_all->GetMaxLength();
   }
 
+  /*!
+   * Sets maximum queue length.
+   * Creates ring buffer - if enabled. Otherwise, provisions enough buffer containers
+   * for a full queue - so that Enqueue() does not need to allocate memory.
+   *
+   * \param new_max_length New maximum queue length
+   */
   void SetMaxQueueLength(int new_max_length)
   {
     if (fifo_queue)
@@ -175,6 +232,62 @@ public:
     {
       queue_all->SetMaxLength(new_max_length);
     }
+
+    if (use_ring_buffer && new_max_length > 0)
+    {
+      ring_buffer.reset(new tSingleProducerRingBuffer<TLockingPointer>(new_max_length));
+      ring_buffer_active.store(source_count <= 1, std::memory_order_relaxed);
+      return;
+    }
+
+    // one additional container for the element that is enqueued while queue is full
+    for (; static_cast<int>(provisioned_containers) < new_max_length + 1; provisioned_containers++)
+    {
+      port_buffer_container_pool.AddBuffer(std::unique_ptr<tPortBufferContainer>(new tPortBufferContainer()));
+    }
+  }
+
+  /*!
+   * Called by port when a source (incoming connection) is connected or disconnected
+   * (structure mutex must be acquired).
+   * If ring buffer is used, values are moved to the container that is used with the new number of sources.
+   *
+   * \param delta Change in number of sources (+1 or -1)
+   */
+  void UpdateSourceCount(int delta)
+  {
+    source_count += delta;
+    bool use_ring_buffer_now = (source_count <= 1);
+    if ((!ring_buffer) || use_ring_buffer_now == ring_buffer_active.load(std::memory_order_relaxed))
+    {
+      return;
+    }
+
+    // wait until no operation accesses the current container
+    switching_container.store(true);
+    while (active_operations.load())
+    {}
+
+    // move values (in order) - the other container is empty
+    if (use_ring_buffer_now)
+    {
+      for (tPortBufferContainerPointer container_pointer = queue_fifo->Dequeue(); container_pointer; container_pointer = queue_fifo->Dequeue())
+      {
+        ring_buffer->Enqueue(std::move(container_pointer->locked_buffer));
+      }
+    }
+    else
+    {
+      for (TLockingPointer pointer = ring_buffer->Dequeue(); pointer; pointer = ring_buffer->Dequeue())
+      {
+        tPortBufferContainerPointer container_pointer = GetUnusedContainer();
+        container_pointer->locked_buffer = std::move(pointer);
+        queue_fifo->Enqueue(container_pointer);
+      }
+    }
+
+    ring_buffer_active.store(use_ring_buffer_now, std::memory_order_relaxed);
+    switching_container.store(false, std::memory_order_release);
   }
 
 //----------------------------------------------------------------------
@@ -194,6 +307,33 @@ private:
   /*! Do we use a FIFO queue? */
   const bool fifo_queue;
 
+  /*! Approximate number of elements in queue (only maintained if data_ports::cCOLLECT_PORT_STATISTICS is set - to detect overflows) */
+  std::atomic<int> approximate_length;
+
+  /*! Port that owns queue */
+  const tAbstractDataPort& owner;
+
+  /*! Number of buffer containers provisioned in SetMaxQueueLength() */
+  size_t provisioned_containers;
+
+  /*! Use ring buffer while port has a single source? */
+  const bool use_ring_buffer;
+
+  /*! Ring buffer for bounded FIFO queues (NULL if not used) */
+  std::unique_ptr<tSingleProducerRingBuffer<TLockingPointer>> ring_buffer;
+
+  /*! Number of sources (incoming connections) of port (structure mutex must be acquired for access) */
+  int source_count;
+
+  /*! Are values currently stored in ring buffer? (otherwise they are stored in concurrent FIFO queue - only relevant if ring buffer is used) */
+  std::atomic<bool> ring_buffer_active;
+
+  /*! Are values currently moved to the other container? (enqueue and dequeue operations wait while this is true) */
+  std::atomic<bool> switching_container;
+
+  /*! Number of enqueue and dequeue operations that currently access a container (only maintained if ring buffer is used) */
+  std::atomic<int> active_operations;
+
   union
   {
     /*! FIFO Queue for ports with incoming value queue */
@@ -203,6 +343,90 @@ private:
     tDequeueAllPortQueue* queue_all;
   };
 
+
+  /*!
+   * Dequeues locked buffer from concurrent FIFO queue
+   */
+  TLockingPointer DequeueFromFifoQueue()
+  {
+    tPortBufferContainerPointer ptr = queue_fifo->Dequeue();
+    if (cCOLLECT_PORT_STATISTICS && ptr)
+    {
+      approximate_length.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return ptr ? std::move(ptr->locked_buffer) : TLockingPointer();
+  }
+
+  /*!
+   * Enqueues locked buffer in concurrent queue (FIFO or dequeue-all)
+   *
+   * \return True if queue was full, so that the oldest element was discarded (see Enqueue())
+   */
+  bool EnqueueInQueue(TLockingPointer && pointer)
+  {
+    tPortBufferContainerPointer container_pointer = GetUnusedContainer();
+    container_pointer->locked_buffer = std::move(pointer);
+    if (fifo_queue)
+    {
+      queue_fifo->Enqueue(container_pointer);
+    }
+    else
+    {
+      queue_all->Enqueue(container_pointer);
+    }
+
+    if (cCOLLECT_PORT_STATISTICS)
+    {
+      int max_length = GetMaxQueueLength();
+      if (max_length > 0 && approximate_length.fetch_add(1, std::memory_order_relaxed) >= max_length)
+      {
+        approximate_length.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /*!
+   * Registers enqueue or dequeue operation that accesses the active container
+   * (waits while values are moved to the other container - see UpdateSourceCount())
+   */
+  void EnterOperation()
+  {
+    while (true)
+    {
+      active_operations.fetch_add(1);
+      if (!switching_container.load())
+      {
+        return;
+      }
+      active_operations.fetch_sub(1);
+      while (switching_container.load(std::memory_order_acquire))
+      {}
+    }
+  }
+
+  /*!
+   * Unregisters operation registered with EnterOperation()
+   */
+  void ExitOperation()
+  {
+    active_operations.fetch_sub(1, std::memory_order_release);
+  }
+
+  /*!
+   * \return Unused buffer container (allocated if there is none)
+   */
+  tPortBufferContainerPointer GetUnusedContainer()
+  {
+    tPortBufferContainerPointer container_pointer = port_buffer_container_pool.GetUnusedBuffer();
+    if (!container_pointer)
+    {
+      tAllocationMonitor::ReportAllocation(tAllocationSite::QUEUE_CONTAINER, owner.GetDataType(), &owner);
+      container_pointer = port_buffer_container_pool.AddBuffer(std::unique_ptr<tPortBufferContainer>(new tPortBufferContainer()));
+    }
+    return container_pointer;
+  }
 };
 
 //----------------------------------------------------------------------
@@ -0,0 +1,231 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tPortStatistics.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tPortStatistics
+ *
+ * \b tPortStatistics
+ *
+ * Lock-free per-port counters for publish, receive, pull and drop events.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__common__tPortStatistics_h__
+#define __plugins__data_ports__common__tPortStatistics_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Events that are counted per port */
+enum class tPortCounter
+{
+  PUBLISH,            //!< Value was published via this port (port is origin of publishing operation)
+  RECEIVE,            //!< Value was received from another port
+  DROPPED_BY_BOUNDS,  //!< Value was discarded, because it was out of bounds
+  QUEUE_OVERFLOW,     //!< Oldest value in input queue was discarded, because queue was full
+  PULL,               //!< Value was pulled via this port
+  PULL_CACHE_HIT,     //!< Pull request handler of this port was not called, because last pulled value was still fresh (see tAbstractDataPort::SetPullCacheWindow())
+  DIMENSION
+};
+
+/*!
+ * Snapshot of a port's counters
+ */
+struct tPortStatisticsSnapshot
+{
+  /*! Counter values (index is tPortCounter) */
+  std::array<uint64_t, static_cast<size_t>(tPortCounter::DIMENSION)> counters;
+
+  tPortStatisticsSnapshot() : counters()
+  {
+    counters.fill(0);
+  }
+
+  /*!
+   * \param counter Counter to get value of
+   * \return Value of specified counter
+   */
+  uint64_t Get(tPortCounter counter) const
+  {
+    return counters[static_cast<size_t>(counter)];
+  }
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Per-port counters
+/*!
+ * Lock-free counters for events on a single port.
+ *
+ * Counters are sharded by thread: Each thread increments counters in one of cSHARDS
+ * cache-line-sized shards, so threads publishing via the same port concurrently
+ * do not contend on the same cache line (as long as there are no more than cSHARDS of them).
+ * Values of all shards are summed up when a snapshot is created.
+ * Objects are allocated at cache line boundaries (see operator new).
+ *
+ * Only instantiated for ports if data_ports::cCOLLECT_PORT_STATISTICS is set.
+ */
+class tPortStatistics
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Number of shards */
+  enum { cSHARDS = 8 };
+
+  /*! Cache line size (alignment of shards) */
+  enum { cCACHE_LINE_SIZE = 64 };
+
+  tPortStatistics() : shards()
+  {
+    for (tShard & shard : shards)
+    {
+      for (std::atomic<uint64_t>& counter : shard.counters)
+      {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /*!
+   * \return Snapshot of current counter values
+   */
+  tPortStatisticsSnapshot GetSnapshot() const
+  {
+    tPortStatisticsSnapshot result;
+    for (const tShard & shard : shards)
+    {
+      for (size_t i = 0; i < result.counters.size(); i++)
+      {
+        result.counters[i] += shard.counters[i].load(std::memory_order_relaxed);
+      }
+    }
+    return result;
+  }
+
+  /*!
+   * Increments counter
+   *
+   * \param counter Counter to increment
+   * \param amount Amount to add to counter
+   */
+  inline void Increment(tPortCounter counter, uint64_t amount = 1)
+  {
+    shards[GetThreadShardIndex()].counters[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+  }
+
+  /*!
+   * Allocates memory for tPortStatistics object aligned to cache line size
+   * (plain operator new only guarantees alignment of max_align_t)
+   */
+  static void* operator new(size_t size);
+  static void operator delete(void* pointer);
+
+  /*!
+   * Resets all counters to zero
+   */
+  void Reset()
+  {
+    for (tShard & shard : shards)
+    {
+      for (std::atomic<uint64_t>& counter : shard.counters)
+      {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Counters of one shard - aligned and padded to cache line size */
+  struct alignas(cCACHE_LINE_SIZE) tShard
+  {
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(tPortCounter::DIMENSION)> counters;
+  };
+  static_assert(sizeof(tShard) == cCACHE_LINE_SIZE, "Shard should occupy exactly one cache line");
+
+  /*! Shards */
+  std::array<tShard, cSHARDS> shards;
+
+  /*! Shard index of current thread (-1 if not assigned yet) */
+  static __thread int thread_shard_index;
+
+  /*!
+   * \return Shard index of current thread
+   */
+  static inline int GetThreadShardIndex()
+  {
+    if (thread_shard_index < 0)
+    {
+      thread_shard_index = AssignThreadShardIndex();
+    }
+    return thread_shard_index;
+  }
+
+  /*!
+   * \return Shard index for new thread (assigned round-robin)
+   */
+  static int AssignThreadShardIndex();
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -44,6 +44,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/standard/tEpochReclamation.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -96,6 +97,25 @@ public:
    */
   template <bool REVERSE, tChangeStatus CHANGE_CONSTANT, bool BROWSER_PUBLISH, bool NOTIFY_LISTENER_ON_THIS_PORT>
   inline void Execute(TPort& port)
+  {
+    standard::tEpochReclamation::tReadGuard epoch_guard;  // push plan and listener tables are accessed without lock
+    Execute<REVERSE, CHANGE_CONSTANT, BROWSER_PUBLISH, NOTIFY_LISTENER_ON_THIS_PORT>(port, (CHANGE_CONSTANT == tChangeStatus::CHANGED) ? port.GetPushPlan() : NULL);
+  }
+
+  /*!
+   * Performs publishing operation along the specified push plan
+   * (variant for publishers that derived the number of locks to add from the port's push plan:
+   *  the push plan the number was derived from must be used for publishing.
+   *  Caller must pin epoch with standard::tEpochReclamation::tReadGuard before obtaining the push plan)
+   *
+   * \param port (Output) port to perform publishing operation on
+   * \param push_plan Port's push plan (as obtained by port.GetPushPlan()) - NULL to traverse connections instead
+   * \tparam REVERSE Publish in reverse direction? (typical is forward)
+   * \tparam CHANGE_CONSTANT changedConstant to use
+   * \tparam BROWSER_PUBLISH Inform this port's listeners on change and also publish in reverse direction? (only set from BrowserPublish())
+   */
+  template <bool REVERSE, tChangeStatus CHANGE_CONSTANT, bool BROWSER_PUBLISH, bool NOTIFY_LISTENER_ON_THIS_PORT>
+  inline void Execute(TPort& port, const tAbstractDataPort::tPushPlan* push_plan)
   {
     uint flag_query = port.GetAllFlags().Raw() & cRAW_FLAGS_READY_AND_HIJACKED;
     if (flag_query != cRAW_FLAG_READY && (!BROWSER_PUBLISH))
@@ -113,6 +133,7 @@ public:
       this->CheckRecycle();
       return;
     }
+    port.IncrementCounter(tPortCounter::PUBLISH);
 
     // inform listeners?
     if (NOTIFY_LISTENER_ON_THIS_PORT)
@@ -128,12 +149,19 @@ public:
 
     if (!REVERSE)
     {
-      for (auto it = port.OutgoingConnectionsBegin(); it != port.OutgoingConnectionsEnd(); ++it)
+      if (push_plan && CHANGE_CONSTANT == tChangeStatus::CHANGED)
       {
-        TPort& destination_port = static_cast<TPort&>(*it);
-        if (destination_port.template WantsPush<REVERSE, CHANGE_CONSTANT>())
+        ExecutePushPlan<CHANGE_CONSTANT>(*push_plan);
+      }
+      else
+      {
+        for (auto it = port.OutgoingConnectionsBegin(); it != port.OutgoingConnectionsEnd(); ++it)
         {
-          Receive<REVERSE, CHANGE_CONSTANT>(*this, destination_port, port);
+          TPort& destination_port = static_cast<TPort&>(*it);
+          if (destination_port.template WantsPush<REVERSE, CHANGE_CONSTANT>())
+          {
+            Receive<REVERSE, CHANGE_CONSTANT>(*this, destination_port, port);
+          }
         }
       }
     }
@@ -153,6 +181,8 @@ public:
   }
 
   /*!
+   * (caller must pin epoch with standard::tEpochReclamation::tReadGuard - as listener tables are accessed)
+   *
    * \param publishing_data Custom data on publishing operation
    * \param port Port that receives data
    * \param origin Port that value was received from
@@ -162,10 +192,12 @@ public:
   template <bool REVERSE, tChangeStatus CHANGE_CONSTANT>
   static inline void Receive(typename std::conditional<TPublishingData::cCOPY_ON_RECEIVE, TPublishingData, TPublishingData&>::type publishing_data, TPort& port, TPort& origin)
   {
+    publishing_data.ReserveLocks(tAbstractDataPort::GetAssignLockCount(port));
     if (!port.template Assign<CHANGE_CONSTANT>(publishing_data))
     {
       return;
     }
+    port.IncrementCounter(tPortCounter::RECEIVE);
     port.SetChanged(CHANGE_CONSTANT);
     port.template NotifyListeners<CHANGE_CONSTANT>(publishing_data);
     port.UpdateStatistics(publishing_data, origin, port);
@@ -199,6 +231,33 @@ public:
 //----------------------------------------------------------------------
 private:
 
+  /*!
+   * Pushes value to all ports in flattened list of push destinations
+   * (equivalent to calling Receive() on all direct destinations - but without recursion and strategy checks)
+   *
+   * \param push_plan Flattened list of push destinations of publishing port (see tAbstractDataPort::SetTopologyFrozen())
+   * \tparam CHANGE_CONSTANT changedConstant to use
+   */
+  template <tChangeStatus CHANGE_CONSTANT>
+  inline void ExecutePushPlan(const tAbstractDataPort::tPushPlan& push_plan)
+  {
+    for (size_t i = 0; i < push_plan.size();)
+    {
+      const tAbstractDataPort::tPushPlanEntry& entry = push_plan[i];
+      TPort& destination_port = static_cast<TPort&>(*entry.port);
+      if (!destination_port.template Assign<CHANGE_CONSTANT>(*this))
+      {
+        i = entry.subtree_end;
+        continue;
+      }
+      destination_port.IncrementCounter(tPortCounter::RECEIVE);
+      destination_port.SetChanged(CHANGE_CONSTANT);
+      destination_port.template NotifyListeners<CHANGE_CONSTANT>(*this);
+      destination_port.UpdateStatistics(*this, static_cast<TPort&>(*entry.origin), destination_port);
+      i++;
+    }
+  }
+
   /*!
    * Put to separate method as it expands to quite a lot of code that does not need to be inlined
    *
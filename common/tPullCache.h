@@ -0,0 +1,168 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tPullCache.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tPullCache
+ *
+ * \b tPullCache
+ *
+ * Freshness information on a port's last pulled value.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__common__tPullCache_h__
+#define __plugins__data_ports__common__tPullCache_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "rrlib/thread/tLock.h"
+#include "rrlib/time/time.h"
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Pull cache of port with pull request handler
+/*!
+ * Values pulled from a port's pull request handler are stored as the port's current value.
+ * With a pull cache, this value is returned to further pull operations within a freshness window -
+ * without invoking the pull request handler again.
+ * Concurrent pull operations on a port with stale value are serialized via the cache's mutex -
+ * so that only the first one calls the pull request handler and the others obtain its result.
+ */
+class tPullCache : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param freshness_window Period of time that a pulled value is returned to further pull operations
+   */
+  tPullCache(const rrlib::time::tDuration& freshness_window) :
+    freshness_window(std::chrono::duration_cast<std::chrono::steady_clock::duration>(freshness_window).count()),
+    last_pull(cNEVER),
+    mutex()
+  {}
+
+  /*!
+   * \return Period of time that a pulled value is returned to further pull operations
+   */
+  rrlib::time::tDuration GetFreshnessWindow() const
+  {
+    return std::chrono::duration_cast<rrlib::time::tDuration>(std::chrono::steady_clock::duration(freshness_window));
+  }
+
+  /*!
+   * \return Mutex that serializes calls to port's pull request handler
+   */
+  rrlib::thread::tMutex& GetMutex()
+  {
+    return mutex;
+  }
+
+  /*!
+   * Marks port's value as stale (next pull operation will call pull request handler)
+   */
+  void Invalidate()
+  {
+    last_pull.store(cNEVER, std::memory_order_relaxed);
+  }
+
+  /*!
+   * \return Was port's current value pulled within freshness window?
+   */
+  bool IsFresh() const
+  {
+    int64_t last = last_pull.load(std::memory_order_acquire);
+    return last != cNEVER && Now() - last < freshness_window;
+  }
+
+  /*!
+   * Called after port's current value has been pulled
+   */
+  void MarkFresh()
+  {
+    last_pull.store(Now(), std::memory_order_release);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Value of 'last_pull' if port's value has not been pulled yet */
+  enum : int64_t { cNEVER = INT64_MIN };
+
+  /*! Period of time that a pulled value is returned to further pull operations (in steady clock ticks) */
+  const int64_t freshness_window;
+
+  /*! Time of last pull request handler call (in steady clock ticks) */
+  std::atomic<int64_t> last_pull;
+
+  /*! Mutex that serializes calls to port's pull request handler */
+  rrlib::thread::tMutex mutex;
+
+
+  static int64_t Now()
+  {
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
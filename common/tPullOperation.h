@@ -40,6 +40,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -90,6 +91,7 @@ public:
    */
   inline void Execute(TPort& port)
   {
+    port.IncrementCounter(tPortCounter::PULL);
     ExecuteImplementation(port, true);
     this->AddLock(); // lock for return
   }
@@ -113,6 +115,35 @@ private:
       return;
     }
 
+    tPullCache* pull_cache = port.GetPullCache();
+    if ((!first) && port.pull_request_handler && pull_cache)
+    {
+      if (!pull_cache->IsFresh())
+      {
+        rrlib::thread::tLock lock(pull_cache->GetMutex());
+        if (!pull_cache->IsFresh())  // another thread might have pulled value while we were waiting
+        {
+          PullFromSource(port, first);
+          pull_cache->MarkFresh();
+          return;
+        }
+      }
+      port.IncrementCounter(tPortCounter::PULL_CACHE_HIT);
+      port.LockCurrentValueForPublishing(*this);
+      return;
+    }
+    PullFromSource(port, first);
+  }
+
+  /*!
+   * Obtains value from pull request handler or connected source port
+   * (port's current value is set to obtained value)
+   *
+   * \param port (Output) port to perform pull operation on
+   * \param first Is this the call on the first (originating) port?
+   */
+  void PullFromSource(TPort& port, bool first)
+  {
     if ((!first) && port.pull_request_handler)
     {
       port.CallPullRequestHandler(*this);
@@ -0,0 +1,218 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tReferenceAndReuseCounter.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tReferenceAndReuseCounter
+ *
+ * \b tReferenceAndReuseCounter
+ *
+ * Atomic reference counter and reuse counter of a port buffer - packed into a single integer.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__common__tReferenceAndReuseCounter_h__
+#define __plugins__data_ports__common__tReferenceAndReuseCounter_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Packed reference and reuse counter
+/*!
+ * Atomic reference counter and reuse counter of a port buffer - packed into a single integer,
+ * so that both can be modified with a single atomic operation.
+ * Lowest bits of reuse counter are used as tag in tagged pointers to port buffers in order to avoid the ABA problem.
+ *
+ * Two layouts are available:
+ *  - 32 bit: 16 bit reference counter, 16 bit reuse counter, 3 bit pointer tags
+ *  - 64 bit: 32 bit reference counter, 32 bit reuse counter, 16 bit pointer tags (3 bit on 32 bit platforms)
+ *
+ * \tparam WIDE Use 64 bit layout?
+ */
+template <bool WIDE>
+class tReferenceAndReuseCounter
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Integer type that stores both counters */
+  typedef typename std::conditional<WIDE, int64_t, int32_t>::type tStorage;
+
+  /*! Reference counter is stored in upper bits - starting at this bit */
+  enum { cCOUNTER_SHIFT = WIDE ? 32 : 16 };
+
+  /*! Number of bits of pointer tag (tagged pointers need to support this bit width) */
+  enum { cTAG_BITS = (WIDE && sizeof(void*) == 8) ? 16 : 3 };
+
+  /*! Mask for lowest bits from reuse counter to use in port pointer tag */
+  enum { cTAG_MASK = (1 << cTAG_BITS) - 1 };
+
+  /*! Mask for reuse counter */
+  static constexpr tStorage cREUSE_COUNTER_MASK = (static_cast<tStorage>(1) << cCOUNTER_SHIFT) - 1;
+
+  tReferenceAndReuseCounter() : value(0) {}
+
+  /*!
+   * Adds locks
+   *
+   * \param locks_to_add number of locks to add
+   * \return Previous raw value
+   */
+  inline tStorage AddLocks(int locks_to_add)
+  {
+    return value.fetch_add(static_cast<tStorage>(locks_to_add) << cCOUNTER_SHIFT);
+  }
+
+  /*!
+   * \param raw_value Raw value
+   * \return Reference counter contained in raw value
+   */
+  static inline int GetReferenceCounter(tStorage raw_value)
+  {
+    return static_cast<int>(raw_value >> cCOUNTER_SHIFT);
+  }
+
+  /*!
+   * \param raw_value Raw value
+   * \return Pointer tag contained in raw value
+   */
+  static inline int GetTag(tStorage raw_value)
+  {
+    return static_cast<int>(raw_value & cTAG_MASK);
+  }
+
+  /*!
+   * Initializes counter for next use (increments reuse counter)
+   *
+   * \param initial_number_of_locks Set reference counter to this value
+   * \return Pointer tag to use for this buffer publishing operation
+   */
+  inline int Init(int initial_number_of_locks)
+  {
+    tStorage new_use_count = (value.load() + 1) & cREUSE_COUNTER_MASK;
+    value.store((static_cast<tStorage>(initial_number_of_locks) << cCOUNTER_SHIFT) | new_use_count);
+    return GetTag(new_use_count);
+  }
+
+  /*!
+   * \return Current raw value
+   */
+  inline tStorage Load() const
+  {
+    return value.load();
+  }
+
+  /*!
+   * Releases locks
+   *
+   * \param locks_to_release number of locks to release
+   * \return Previous raw value
+   */
+  inline tStorage ReleaseLocks(int locks_to_release)
+  {
+    return value.fetch_sub(static_cast<tStorage>(locks_to_release) << cCOUNTER_SHIFT);
+  }
+
+  /*!
+   * Sets reference and reuse counter to zero
+   *
+   * \return Previous raw value
+   */
+  inline tStorage Reset()
+  {
+    return value.exchange(0);
+  }
+
+  /*!
+   * Adds locks - only if reference counter is greater than zero and pointer tag matches
+   *
+   * \param locks_to_add number of locks to add
+   * \param pointer_tag Pointer tag that must match
+   * \return Returns whether locking succeeded
+   */
+  inline bool TryLock(int locks_to_add, int pointer_tag)
+  {
+    tStorage current_value = value.load();
+    while (GetReferenceCounter(current_value) > 0 && GetTag(current_value) == pointer_tag)
+    {
+      tStorage new_value = current_value + (static_cast<tStorage>(locks_to_add) << cCOUNTER_SHIFT);
+      if (value.compare_exchange_strong(current_value, new_value))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Upper bits: reference counter - lower bits: reuse counter */
+  std::atomic<tStorage> value;
+
+};
+
+template <bool WIDE>
+constexpr typename tReferenceAndReuseCounter<WIDE>::tStorage tReferenceAndReuseCounter<WIDE>::cREUSE_COUNTER_MASK;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
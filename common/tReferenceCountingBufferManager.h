@@ -45,7 +45,9 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/definitions.h"
 #include "plugins/data_ports/common/tAbstractPortBufferManager.h"
+#include "plugins/data_ports/common/tReferenceAndReuseCounter.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -77,12 +79,15 @@ class tReferenceCountingBufferManager : public tAbstractPortBufferManager<rrlib:
 //----------------------------------------------------------------------
 public:
 
+  /*! Packed reference and reuse counter (layout is selected by data_ports::cWIDE_REFERENCE_COUNTERS) */
+  typedef tReferenceAndReuseCounter<cWIDE_REFERENCE_COUNTERS> tCounter;
+
   /*!
    * Mask for lowest bits from reuse counter to use in port pointer tag
    * order to avoid the ABA problem
    */
-  enum { cTAG_MASK = 0x7 };
-  enum { cREUSE_COUNTER_MASK = 0xFFFF };
+  enum { cTAG_BITS = tCounter::cTAG_BITS };
+  enum { cTAG_MASK = tCounter::cTAG_MASK };
 
   /*!
    * Adds Locks
@@ -92,7 +97,7 @@ public:
    */
   inline int AddLocks(int locks_to_add)
   {
-    return reference_and_reuse_counter.fetch_add(locks_to_add << 16) & cTAG_MASK;
+    return tCounter::GetTag(reference_and_reuse_counter.AddLocks(locks_to_add));
   }
 
   /*!
@@ -103,8 +108,8 @@ public:
    */
   inline void AddLocks(int locks_to_add, int check_tag)
   {
-    __attribute__((unused)) int old_value = reference_and_reuse_counter.fetch_add(locks_to_add << 16);
-    assert((old_value & cTAG_MASK) == check_tag && "corrupted tag detected");
+    __attribute__((unused)) tCounter::tStorage old_value = reference_and_reuse_counter.AddLocks(locks_to_add);
+    assert(tCounter::GetTag(old_value) == check_tag && "corrupted tag detected");
   }
 
   /*!
@@ -112,7 +117,7 @@ public:
    */
   inline int GetPointerTag() const
   {
-    return reference_and_reuse_counter.load() & cTAG_MASK;
+    return tCounter::GetTag(reference_and_reuse_counter.Load());
   }
 
   /*!
@@ -123,9 +128,7 @@ public:
    */
   inline int InitReferenceCounter(int initial_number_of_locks)
   {
-    int new_use_count = (reference_and_reuse_counter.load() + 1) & cREUSE_COUNTER_MASK;
-    reference_and_reuse_counter.store((initial_number_of_locks << 16) | new_use_count);
-    return new_use_count & cTAG_MASK;
+    return reference_and_reuse_counter.Init(initial_number_of_locks);
   }
 
   /*!
@@ -135,10 +138,10 @@ public:
    * \return Previous reference_and_reuse_counter value (only meant for class-internal use)
    */
   template <typename TDeleterType, typename TThis = tReferenceCountingBufferManager>
-  inline int ReleaseLocks(int locks_to_release)
+  inline tCounter::tStorage ReleaseLocks(int locks_to_release)
   {
-    int old_value = reference_and_reuse_counter.fetch_sub(locks_to_release << 16);
-    int old_counter = old_value >> 16;
+    tCounter::tStorage old_value = reference_and_reuse_counter.ReleaseLocks(locks_to_release);
+    int old_counter = tCounter::GetReferenceCounter(old_value);
     assert(old_counter - locks_to_release >= 0 && "negative reference counter detected");
     if (old_counter - locks_to_release == 0)
     {
@@ -158,8 +161,8 @@ public:
   template <typename TDeleterType, typename TThis = tReferenceCountingBufferManager>
   inline void ReleaseLocks(int locks_to_release, int check_tag)
   {
-    __attribute__((unused)) int old_value = ReleaseLocks<TDeleterType, TThis>(locks_to_release);
-    assert((old_value & cTAG_MASK) == check_tag && "corrupted tag detected");
+    __attribute__((unused)) tCounter::tStorage old_value = ReleaseLocks<TDeleterType, TThis>(locks_to_release);
+    assert(tCounter::GetTag(old_value) == check_tag && "corrupted tag detected");
   }
 
   /*!
@@ -171,16 +174,7 @@ public:
    */
   inline bool TryLock(int locks_to_add, int pointer_tag)
   {
-    int current_value = reference_and_reuse_counter.load();
-    while (((current_value >> 16) > 0) && (current_value & cTAG_MASK) == pointer_tag)
-    {
-      int new_value = current_value + (locks_to_add << 16);
-      if (reference_and_reuse_counter.compare_exchange_strong(current_value, new_value))
-      {
-        return true;
-      }
-    }
-    return false;
+    return reference_and_reuse_counter.TryLock(locks_to_add, pointer_tag);
   }
 
   /*!
@@ -188,7 +182,7 @@ public:
    */
   bool Unique() const
   {
-    return (reference_and_reuse_counter.load() >> 16) == 1;
+    return tCounter::GetReferenceCounter(reference_and_reuse_counter.Load()) == 1;
   }
 
 //----------------------------------------------------------------------
@@ -196,11 +190,11 @@ public:
 //----------------------------------------------------------------------
 protected:
 
-  /*! Upper 16 bit: reference counter - lower 16 bit: reuse counter */
-  std::atomic<int> reference_and_reuse_counter;
+  /*! Upper half: reference counter - lower half: reuse counter */
+  tCounter reference_and_reuse_counter;
 
 
-  tReferenceCountingBufferManager() : reference_and_reuse_counter(0) {}
+  tReferenceCountingBufferManager() : reference_and_reuse_counter() {}
 
 };
 
@@ -0,0 +1,247 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tSingleProducerRingBuffer.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tSingleProducerRingBuffer
+ *
+ * \b tSingleProducerRingBuffer
+ *
+ * Bounded ring buffer for input queues of ports with a single source.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__common__tSingleProducerRingBuffer_h__
+#define __plugins__data_ports__common__tSingleProducerRingBuffer_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <memory>
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Bounded single-producer ring buffer
+/*!
+ * Bounded FIFO queue that stores its elements in place in a fixed-size array.
+ * When the queue is full, the oldest element is discarded on Enqueue()
+ * (same behavior as bounded rrlib::concurrent_containers::tQueue).
+ *
+ * Optimized for one producer and one consumer thread:
+ * Enqueueing and dequeueing each need only a few atomic operations - no memory is allocated.
+ * Enqueue() is protected by a spin lock, so that occasional other producers (e.g. from
+ * the network or a tooling thread) are still safe. The lock is uncontended with a single producer.
+ * Since the producer may discard the oldest element, consumer and producer claim elements via CAS on 'head'.
+ * Each slot has a sequence number, so that a slot is not overwritten before its element has been moved out.
+ *
+ * \tparam T Element type (typically std::unique_ptr - default-constructed T is returned if queue is empty)
+ */
+template <typename T>
+class tSingleProducerRingBuffer : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param capacity Maximum number of elements in queue
+   */
+  tSingleProducerRingBuffer(size_t capacity) :
+    capacity(capacity),
+    slot_count(capacity + 1),
+    slots(new tSlot[capacity + 1]),
+    head(0),
+    tail(0)
+  {
+    for (size_t i = 0; i < slot_count; i++)
+    {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    producer_lock.clear();
+  }
+
+  /*!
+   * Dequeues oldest element
+   *
+   * \return Oldest element in queue (default-constructed T if queue is empty)
+   */
+  T Dequeue()
+  {
+    uint64_t index = 0;
+    if (!Claim(index, tail.load(std::memory_order_acquire)))
+    {
+      return T();
+    }
+    return Take(index);
+  }
+
+  /*!
+   * Enqueues element
+   *
+   * \param element Element to enqueue
+   * \return True if queue was full, so that the oldest element was discarded
+   */
+  bool Enqueue(T && element)
+  {
+    while (producer_lock.test_and_set(std::memory_order_acquire))
+    {}
+
+    bool discarded = false;
+    uint64_t current_tail = tail.load(std::memory_order_relaxed);
+    while (current_tail - head.load(std::memory_order_acquire) >= capacity)
+    {
+      uint64_t index = 0;
+      if (Claim(index, current_tail))
+      {
+        T oldest = Take(index);  // released when going out of scope
+        discarded = true;
+      }
+    }
+
+    tSlot& slot = slots[current_tail % slot_count];
+    while (slot.sequence.load(std::memory_order_acquire) != current_tail)
+    {} // previous element in slot is still being moved out by a consumer (rare)
+    slot.element = std::move(element);
+    slot.sequence.store(current_tail + 1, std::memory_order_release);
+    tail.store(current_tail + 1, std::memory_order_release);
+
+    producer_lock.clear(std::memory_order_release);
+    return discarded;
+  }
+
+  /*!
+   * \return Maximum number of elements in queue
+   */
+  size_t GetCapacity() const
+  {
+    return capacity;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Slot in ring buffer */
+  struct tSlot
+  {
+    /*!
+     * Sequence number of slot:
+     * == element index: slot is free for element with this index
+     * == element index + 1: slot contains element with this index
+     */
+    std::atomic<uint64_t> sequence;
+
+    /*! Element stored in slot */
+    T element;
+  };
+
+  /*! Maximum number of elements in queue */
+  const size_t capacity;
+
+  /*! Number of slots (one more than capacity - so that the producer does not need to wait for a consumer that moves an element out of the slot) */
+  const size_t slot_count;
+
+  /*! Slots */
+  std::unique_ptr<tSlot[]> slots;
+
+  /*! Index of oldest element in queue */
+  std::atomic<uint64_t> head;
+
+  /*! Index of next element to enqueue */
+  std::atomic<uint64_t> tail;
+
+  /*! Spin lock for producers */
+  std::atomic_flag producer_lock;
+
+  /*!
+   * Claims oldest element in queue
+   *
+   * \param index Index of claimed element (output)
+   * \param current_tail Value of tail (elements with smaller index are claimed)
+   * \return True if an element was claimed (false if queue is empty)
+   */
+  bool Claim(uint64_t& index, uint64_t current_tail)
+  {
+    index = head.load(std::memory_order_acquire);
+    while (index < current_tail)
+    {
+      if (head.compare_exchange_weak(index, index + 1, std::memory_order_acq_rel))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /*!
+   * Moves claimed element out of its slot
+   *
+   * \param index Index of claimed element
+   * \return Element
+   */
+  T Take(uint64_t index)
+  {
+    tSlot& slot = slots[index % slot_count];
+    while (slot.sequence.load(std::memory_order_acquire) != index + 1)
+    {}
+    T result = std::move(slot.element);
+    slot.sequence.store(index + slot_count, std::memory_order_release);
+    return result;
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -0,0 +1,399 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tStartupProfiler.cpp
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/data_ports/common/tStartupProfiler.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+#include "rrlib/thread/tLock.h"
+#include "core/log_messages.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Names of phases (index is tStartupPhase) */
+static const char* cPHASE_NAMES[] = { "port creation", "value deserialization", "buffer prewarming", "strategy propagation", "initial pushing" };
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+std::atomic<bool> tStartupProfiler::enabled(false);
+__thread size_t tStartupProfiler::thread_allocation_count = 0;
+
+namespace internal
+{
+
+/*! Record of phase in thread buffer (times in nanoseconds) */
+struct tThreadRecord
+{
+  tStartupPhase phase;
+  const core::tFrameworkElement* port;
+
+  /*! Index of record of enclosing scope (-1 if there is none) */
+  int parent;
+
+  int64_t start, duration, self_time;
+  size_t start_allocations;
+  int64_t self_allocations;
+};
+
+/*! Records of current thread's scopes (until outermost scope ends) */
+struct tThreadBuffer
+{
+  std::vector<tThreadRecord> records;
+
+  /*! Index of record of innermost active scope (-1 if there is none) */
+  int current;
+
+  /*! Index of thread in trace (-1 if not assigned yet) */
+  int thread_index;
+
+  tThreadBuffer() : records(), current(-1), thread_index(-1)
+  {}
+};
+
+/*! Recorded phase (times in nanoseconds) */
+struct tEvent
+{
+  tStartupPhase phase;
+
+  /*! Index of port in ports (-1 if unknown) */
+  int port_index;
+
+  int thread_index;
+  int64_t start, duration, self_time, allocations;
+};
+
+/*! Time spent and allocations per port */
+struct tPortEntry
+{
+  std::string name;
+  int64_t time, allocations;
+};
+
+/*! All recorded data */
+struct tRecordedData
+{
+  rrlib::thread::tMutex mutex;
+
+  /*! Time when profiling was first enabled (time_since_epoch() of steady clock in nanoseconds - 0 if not enabled yet) */
+  std::atomic<int64_t> start;
+
+  std::vector<tEvent> events;
+  std::vector<tPortEntry> ports;
+  std::unordered_map<std::string, size_t> port_indices;
+  int thread_count;
+
+  tRecordedData() : mutex(), start(0), events(), ports(), port_indices(), thread_count(0)
+  {}
+};
+
+static tRecordedData& RecordedData()
+{
+  static tRecordedData data;
+  return data;
+}
+
+static tThreadBuffer& ThreadBuffer()
+{
+  static thread_local tThreadBuffer buffer;
+  return buffer;
+}
+
+static int64_t Now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() - RecordedData().start.load(std::memory_order_relaxed);
+}
+
+/*!
+ * Adds records of thread buffer to recorded data (after outermost scope has ended)
+ */
+static void Flush(tThreadBuffer& buffer)
+{
+  for (tThreadRecord & record : buffer.records)
+  {
+    if ((!record.port) && record.parent >= 0)
+    {
+      record.port = buffer.records[record.parent].port;  // parents precede children - so they are already resolved
+    }
+  }
+
+  tRecordedData& data = RecordedData();
+  rrlib::thread::tLock lock(data.mutex);
+  if (buffer.thread_index < 0)
+  {
+    buffer.thread_index = data.thread_count++;
+  }
+  for (const tThreadRecord & record : buffer.records)
+  {
+    tEvent event = { record.phase, -1, buffer.thread_index, record.start, record.duration, record.self_time, record.self_allocations };
+    if (record.port)
+    {
+      std::string name = record.port->GetQualifiedName();
+      auto it = data.port_indices.find(name);
+      if (it == data.port_indices.end())
+      {
+        it = data.port_indices.emplace(name, data.ports.size()).first;
+        data.ports.push_back({ name, 0, 0 });
+      }
+      event.port_index = static_cast<int>(it->second);
+      data.ports[it->second].time += record.self_time;
+      data.ports[it->second].allocations += record.self_allocations;
+    }
+    data.events.push_back(event);
+  }
+  buffer.records.clear();
+}
+
+/*!
+ * \return String with special characters escaped for JSON
+ */
+static std::string EscapeJson(const std::string& s)
+{
+  std::ostringstream result;
+  for (char c : s)
+  {
+    if (c == '"' || c == '\\')
+    {
+      result << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      result << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+    }
+    else
+    {
+      result << c;
+    }
+  }
+  return result.str();
+}
+
+}
+
+int tStartupProfiler::Begin(tStartupPhase phase, const core::tFrameworkElement* port)
+{
+  internal::tThreadBuffer& buffer = internal::ThreadBuffer();
+  int index = static_cast<int>(buffer.records.size());
+  internal::tThreadRecord record = { phase, port, buffer.current, internal::Now(), 0, 0, thread_allocation_count, 0 };
+  buffer.records.push_back(record);
+  buffer.current = index;
+  return index;
+}
+
+void tStartupProfiler::End(int record_index)
+{
+  internal::tThreadBuffer& buffer = internal::ThreadBuffer();
+  assert(record_index == buffer.current && "Scopes must be nested");
+  internal::tThreadRecord& record = buffer.records[record_index];
+  int64_t duration = internal::Now() - record.start;
+  int64_t allocations = static_cast<int64_t>(thread_allocation_count - record.start_allocations);
+  record.duration = duration;
+  record.self_time += duration;
+  record.self_allocations += allocations;
+  buffer.current = record.parent;
+  if (record.parent >= 0)
+  {
+    internal::tThreadRecord& parent = buffer.records[record.parent];
+    parent.self_time -= duration;
+    parent.self_allocations -= allocations;
+  }
+  else
+  {
+    internal::Flush(buffer);
+  }
+}
+
+std::string tStartupProfiler::GetSummary(size_t max_ports)
+{
+  internal::tRecordedData& data = internal::RecordedData();
+  rrlib::thread::tLock lock(data.mutex);
+
+  struct tPhaseEntry
+  {
+    size_t phase, calls;
+    int64_t time, allocations;
+  };
+  std::vector<tPhaseEntry> phases;
+  int64_t total_time = 0, total_allocations = 0;
+  for (size_t i = 0; i < static_cast<size_t>(tStartupPhase::DIMENSION); i++)
+  {
+    phases.push_back({ i, 0, 0, 0 });
+  }
+  for (const internal::tEvent & event : data.events)
+  {
+    tPhaseEntry& entry = phases[static_cast<size_t>(event.phase)];
+    entry.calls++;
+    entry.time += event.self_time;
+    entry.allocations += event.allocations;
+    total_time += event.self_time;
+    total_allocations += event.allocations;
+  }
+  std::sort(phases.begin(), phases.end(), [](const tPhaseEntry & a, const tPhaseEntry & b)
+  {
+    return a.time > b.time || (a.time == b.time && a.allocations > b.allocations);
+  });
+
+  std::vector<const internal::tPortEntry*> ports;
+  for (const internal::tPortEntry & port : data.ports)
+  {
+    ports.push_back(&port);
+  }
+  std::sort(ports.begin(), ports.end(), [](const internal::tPortEntry * a, const internal::tPortEntry * b)
+  {
+    return a->time > b->time || (a->time == b->time && a->allocations > b->allocations);
+  });
+
+  std::ostringstream result;
+  result << std::fixed << std::setprecision(3);
+  result << "Startup profile of data ports: " << (total_time / 1000000.0) << " ms, " << total_allocations << " allocations, " << data.ports.size() << " ports" << std::endl;
+  result << "Phases:" << std::endl;
+  for (const tPhaseEntry & entry : phases)
+  {
+    result << "  " << std::left << std::setw(24) << cPHASE_NAMES[entry.phase] << std::right << std::setw(12) << (entry.time / 1000000.0) << " ms "
+           << std::setprecision(1) << std::setw(6) << (total_time ? (100.0 * entry.time / total_time) : 0.0) << "% " << std::setprecision(3)
+           << std::setw(10) << entry.calls << " calls " << std::setw(10) << entry.allocations << " allocations" << std::endl;
+  }
+  result << "Ports (" << std::min(max_ports, ports.size()) << " most expensive):" << std::endl;
+  for (size_t i = 0; i < ports.size() && i < max_ports; i++)
+  {
+    result << "  " << std::setw(12) << (ports[i]->time / 1000000.0) << " ms " << std::setw(10) << ports[i]->allocations << " allocations  " << ports[i]->name << std::endl;
+  }
+  return result.str();
+}
+
+void tStartupProfiler::PrintSummary(size_t max_ports)
+{
+  FINROC_LOG_PRINT_STATIC(USER, GetSummary(max_ports));
+}
+
+void tStartupProfiler::Reset()
+{
+  internal::tRecordedData& data = internal::RecordedData();
+  rrlib::thread::tLock lock(data.mutex);
+  data.events.clear();
+  data.ports.clear();
+  data.port_indices.clear();
+  data.start.store(0);
+  if (IsEnabled())
+  {
+    data.start.store(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+  }
+}
+
+void tStartupProfiler::SetEnabled(bool enable)
+{
+  internal::tRecordedData& data = internal::RecordedData();
+  rrlib::thread::tLock lock(data.mutex);
+  if (enable && data.start.load() == 0)
+  {
+    data.start.store(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+  }
+  enabled.store(enable);
+}
+
+void tStartupProfiler::SetPort(int record_index, const core::tFrameworkElement* port)
+{
+  internal::ThreadBuffer().records[record_index].port = port;
+}
+
+bool tStartupProfiler::WriteChromeTrace(const std::string& filename)
+{
+  internal::tRecordedData& data = internal::RecordedData();
+  rrlib::thread::tLock lock(data.mutex);
+  std::ofstream file(filename);
+  if (!file)
+  {
+    FINROC_LOG_PRINT_STATIC(ERROR, "Could not open file '", filename, "' for writing startup trace");
+    return false;
+  }
+
+  file << std::fixed << std::setprecision(3);
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  for (const internal::tEvent & event : data.events)
+  {
+    file << (first ? "\n" : ",\n");
+    first = false;
+    file << "{\"name\":\"" << cPHASE_NAMES[static_cast<size_t>(event.phase)] << "\",\"cat\":\"data_ports\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread_index
+         << ",\"ts\":" << (event.start / 1000.0) << ",\"dur\":" << (event.duration / 1000.0) << ",\"args\":{";
+    if (event.port_index >= 0)
+    {
+      file << "\"port\":\"" << internal::EscapeJson(data.ports[event.port_index].name) << "\",";
+    }
+    file << "\"self_time_us\":" << (event.self_time / 1000.0) << ",\"allocations\":" << event.allocations << "}}";
+  }
+  file << "\n]}\n";
+  return file.good();
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
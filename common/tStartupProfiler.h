@@ -0,0 +1,236 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/common/tStartupProfiler.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tStartupProfiler
+ *
+ * \b tStartupProfiler
+ *
+ * Records where time is spent and memory is allocated while data ports are created and connected.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__common__tStartupProfiler_h__
+#define __plugins__data_ports__common__tStartupProfiler_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <string>
+#include "rrlib/util/tNoncopyable.h"
+#include "core/tFrameworkElement.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace common
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*! Phases of port creation and connection that are profiled */
+enum class tStartupPhase
+{
+  PORT_CREATION,          //!< Processing of port creation info and construction of port (excluding nested phases)
+  VALUE_DESERIALIZATION,  //!< Deserialization of default values and bounds from port creation info
+  BUFFER_PREWARMING,      //!< Filling buffer pools up front
+  STRATEGY_PROPAGATION,   //!< Propagation of strategies on connection and strategy changes
+  INITIAL_PUSHING,        //!< Initial pushes to newly connected ports
+  DIMENSION
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Startup profiler
+/*!
+ * Records wall time and allocations (see tAllocationMonitor - these are counted regardless of the
+ * "system started" barrier) of the phases in tStartupPhase - per phase and per port.
+ * Phases are recorded via tScope objects. Time and allocations of nested scopes are only attributed
+ * to the innermost scope - so that totals add up. Nested scopes without port are attributed to the port
+ * of the enclosing scope.
+ *
+ * Profiling is disabled by default. While disabled, scopes only check a flag.
+ * Results can be obtained as summary sorted by cost (GetSummary()) or as trace file
+ * that can be loaded in Chrome's trace viewer (WriteChromeTrace()).
+ */
+class tStartupProfiler : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * Profiles specified phase while object exists
+   */
+  class tScope : private rrlib::util::tNoncopyable
+  {
+  public:
+
+    /*!
+     * \param phase Phase to profile
+     * \param port Port that phase is executed for (NULL if unknown or same as in enclosing scope)
+     */
+    tScope(tStartupPhase phase, const core::tFrameworkElement* port = NULL) :
+      record_index(IsEnabled() ? Begin(phase, port) : -1)
+    {}
+
+    ~tScope()
+    {
+      if (record_index >= 0)
+      {
+        End(record_index);
+      }
+    }
+
+    /*!
+     * Sets port that phase is executed for (e.g. once port has been created)
+     *
+     * \param port Port
+     */
+    void SetPort(const core::tFrameworkElement* port)
+    {
+      if (record_index >= 0)
+      {
+        tStartupProfiler::SetPort(record_index, port);
+      }
+    }
+
+  private:
+
+    /*! Index of record in current thread's buffer (-1 if profiling was disabled) */
+    const int record_index;
+  };
+
+  /*!
+   * Called whenever memory is allocated by data ports (see tAllocationMonitor::ReportAllocation())
+   */
+  static inline void CountAllocation()
+  {
+    if (IsEnabled())
+    {
+      thread_allocation_count++;
+    }
+  }
+
+  /*!
+   * \param max_ports Maximum number of ports to list
+   * \return Summary of recorded data: phases and ports sorted by time spent (most expensive first)
+   */
+  static std::string GetSummary(size_t max_ports = 20);
+
+  /*!
+   * \return Is startup profiling enabled?
+   */
+  static inline bool IsEnabled()
+  {
+    return enabled.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * Prints summary (see GetSummary()) to log
+   *
+   * \param max_ports Maximum number of ports to list
+   */
+  static void PrintSummary(size_t max_ports = 20);
+
+  /*!
+   * Discards all recorded data
+   */
+  static void Reset();
+
+  /*!
+   * Enables or disables startup profiling.
+   * Timestamps in trace are relative to the first time profiling was enabled (after Reset()).
+   *
+   * \param enable Whether to enable profiling
+   */
+  static void SetEnabled(bool enable);
+
+  /*!
+   * Writes recorded data to file in Chrome's trace event format (can be loaded via chrome://tracing)
+   *
+   * \param filename Name of file to write
+   * \return Whether file was written successfully
+   */
+  static bool WriteChromeTrace(const std::string& filename);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Is startup profiling enabled? */
+  static std::atomic<bool> enabled;
+
+  /*! Number of allocations by current thread while profiling was enabled */
+  static __thread size_t thread_allocation_count;
+
+
+  /*!
+   * Starts recording phase in current thread
+   *
+   * \return Index of record in current thread's buffer
+   */
+  static int Begin(tStartupPhase phase, const core::tFrameworkElement* port);
+
+  /*!
+   * Ends recording phase in current thread.
+   * When outermost scope ends, records of current thread are added to recorded data.
+   *
+   * \param record_index Index of record in current thread's buffer
+   */
+  static void End(int record_index);
+
+  /*!
+   * Sets port of record in current thread's buffer
+   */
+  static void SetPort(int record_index, const core::tFrameworkElement* port);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
@@ -81,6 +81,27 @@ constexpr rrlib::time::tDuration cPULL_TIMEOUT = std::chrono::seconds(1);
 constexpr core::tFrameworkElement::tFlags cDEFAULT_INPUT_PORT_FLAGS = core::tFrameworkElement::tFlag::ACCEPTS_DATA | core::tFrameworkElement::tFlag::PUSH_STRATEGY;
 constexpr core::tFrameworkElement::tFlags cDEFAULT_OUTPUT_PORT_FLAGS = core::tFrameworkElement::tFlag::EMITS_DATA | core::tFrameworkElement::tFlag::OUTPUT_PORT;
 
+/*!
+ * Collect per-port statistics (publish, receive, pull and drop counters)?
+ * Enabled by defining FINROC_DATA_PORTS_COLLECT_PORT_STATISTICS - independent of debug/release mode.
+ */
+#ifdef FINROC_DATA_PORTS_COLLECT_PORT_STATISTICS
+constexpr bool cCOLLECT_PORT_STATISTICS = true;
+#else
+constexpr bool cCOLLECT_PORT_STATISTICS = false;
+#endif
+
+/*!
+ * Use 64 bit reference and reuse counters in port buffers (32 bit reference counter, 32 bit reuse counter, 16 bit pointer tags)?
+ * Enabled by defining FINROC_DATA_PORTS_WIDE_REFERENCE_COUNTERS.
+ * Otherwise, 32 bit counters are used (16 bit reference counter, 16 bit reuse counter, 3 bit pointer tags) - which is sufficient for typical applications.
+ */
+#ifdef FINROC_DATA_PORTS_WIDE_REFERENCE_COUNTERS
+constexpr bool cWIDE_REFERENCE_COUNTERS = true;
+#else
+constexpr bool cWIDE_REFERENCE_COUNTERS = false;
+#endif
+
 //----------------------------------------------------------------------
 // Function declarations
 //----------------------------------------------------------------------
@@ -40,6 +40,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <vector>
 #include "rrlib/serialization/serialization.h"
 
 //----------------------------------------------------------------------
@@ -103,6 +104,71 @@ public:
     number_type(tType::FLOAT)
   {}
 
+  /*!
+   * Converts many numbers to type T at once.
+   * Numbers are processed in runs of the same number type - so that conversion is a tight loop
+   * without branches that compilers can vectorize (instead of a switch for every value as in Value<T>()).
+   *
+   * \param numbers Numbers to convert
+   * \param count Number of numbers to convert
+   * \param result Array to store converted values in (must have space for 'count' elements)
+   */
+  template <typename T>
+  static void ConvertTo(const tNumber* numbers, size_t count, T* result)
+  {
+    size_t i = 0;
+    while (i < count)
+    {
+      const tType type = numbers[i].number_type;
+      size_t run_end = i + 1;
+      while (run_end < count && numbers[run_end].number_type == type)
+      {
+        run_end++;
+      }
+      switch (type)
+      {
+      case tType::INT64:
+        for (; i < run_end; i++)
+        {
+          result[i] = static_cast<T>(numbers[i].integer_value);
+        }
+        break;
+      case tType::DOUBLE:
+        for (; i < run_end; i++)
+        {
+          result[i] = static_cast<T>(numbers[i].double_value);
+        }
+        break;
+      case tType::FLOAT:
+        for (; i < run_end; i++)
+        {
+          result[i] = static_cast<T>(numbers[i].float_value);
+        }
+        break;
+      default:
+        assert(false && "Not a tNumber at this memory address");
+        i = run_end;
+      }
+    }
+  }
+
+  /*!
+   * Converts many numbers to type T at once (see above) and appends them to vector
+   *
+   * \param numbers Numbers to convert
+   * \param result Vector to append converted values to
+   */
+  template <typename T>
+  static void ConvertTo(const std::vector<tNumber>& numbers, std::vector<T>& result)
+  {
+    if (numbers.size())
+    {
+      size_t offset = result.size();
+      result.resize(offset + numbers.size());
+      ConvertTo(numbers.data(), numbers.size(), &result[offset]);
+    }
+  }
+
   /*!
    * \return What kind of value is stored in this object?
    */
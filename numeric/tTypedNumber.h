@@ -0,0 +1,156 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/numeric/tTypedNumber.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tTypedNumber
+ *
+ * \b tTypedNumber
+ *
+ * Number with type fixed at compile time.
+ * Ports with this type store the native value in their buffers (instead of a numeric::tNumber).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__numeric__tTypedNumber_h__
+#define __plugins__data_ports__numeric__tTypedNumber_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <type_traits>
+#include "rrlib/serialization/serialization.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace numeric
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Number with compile-time type
+/*!
+ * Ports with numeric types (e.g. tPort<double>) use numeric::tNumber in their backend - which allows connecting
+ * ports with different numeric types. The price is a type switch whenever values are accessed.
+ *
+ * Ports of type tPort<tTypedNumber<T>> are not numeric ports. They are cheap-copy ports that store
+ * the native T in their buffers - and can only be connected to ports with exactly the same type.
+ * This is sensible for high-frequency numeric data flowing between components that agree on the type.
+ *
+ * \tparam T Arithmetic type of number
+ */
+template <typename T>
+struct tTypedNumber
+{
+  static_assert(std::is_arithmetic<T>::value, "tTypedNumber only supports arithmetic types");
+
+  /*! Wrapped value */
+  T value;
+
+  tTypedNumber() : value(0)
+  {}
+
+  tTypedNumber(T value) : value(value)
+  {}
+
+  operator T() const
+  {
+    return value;
+  }
+
+  bool operator==(const tTypedNumber& other) const
+  {
+    return value == other.value;
+  }
+
+  bool operator!=(const tTypedNumber& other) const
+  {
+    return value != other.value;
+  }
+
+  bool operator<(const tTypedNumber& other) const
+  {
+    return value < other.value;
+  }
+};
+
+template <typename T>
+inline rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tTypedNumber<T>& number)
+{
+  stream << number.value;
+  return stream;
+}
+
+template <typename T>
+inline rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStream& stream, tTypedNumber<T>& number)
+{
+  stream >> number.value;
+  return stream;
+}
+
+template <typename T>
+inline rrlib::serialization::tStringOutputStream &operator << (rrlib::serialization::tStringOutputStream& stream, const tTypedNumber<T>& number)
+{
+  stream << number.value;
+  return stream;
+}
+
+template <typename T>
+inline rrlib::serialization::tStringInputStream &operator >> (rrlib::serialization::tStringInputStream& stream, tTypedNumber<T>& number)
+{
+  stream >> number.value;
+  return stream;
+}
+
+template <typename T>
+inline std::ostream &operator << (std::ostream &stream, const tTypedNumber<T>& number)
+{
+  stream << number.value;
+  return stream;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
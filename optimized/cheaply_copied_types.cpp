@@ -92,8 +92,10 @@ struct tRegister
   {
     rrlib::rtti::tType type;
     std::atomic<size_t> port_count;
+    std::atomic<size_t> connection_count;
+    std::atomic<size_t> queue_capacity;
 
-    tEntry() : type(), port_count(0)
+    tEntry() : type(), port_count(0), connection_count(0), queue_capacity(0)
     {}
   };
 
@@ -168,6 +170,16 @@ size_t GetPortCount(uint32_t cheaply_copied_type_index)
   return GetRegister().used_types[cheaply_copied_type_index].port_count;
 }
 
+size_t GetConnectionCount(uint32_t cheaply_copied_type_index)
+{
+  return GetRegister().used_types[cheaply_copied_type_index].connection_count;
+}
+
+size_t GetQueueCapacity(uint32_t cheaply_copied_type_index)
+{
+  return GetRegister().used_types[cheaply_copied_type_index].queue_capacity;
+}
+
 size_t GetRegisteredTypeCount()
 {
   return GetRegister().registered_types;
@@ -190,6 +202,26 @@ void UnregisterPort(uint32_t cheaply_copied_type_index)
   GetRegister().used_types[cheaply_copied_type_index].port_count--;
 }
 
+void RegisterConnection(uint32_t cheaply_copied_type_index)
+{
+  GetRegister().used_types[cheaply_copied_type_index].connection_count++;
+}
+
+void UnregisterConnection(uint32_t cheaply_copied_type_index)
+{
+  GetRegister().used_types[cheaply_copied_type_index].connection_count--;
+}
+
+void RegisterQueue(uint32_t cheaply_copied_type_index, size_t capacity)
+{
+  GetRegister().used_types[cheaply_copied_type_index].queue_capacity += capacity;
+}
+
+void UnregisterQueue(uint32_t cheaply_copied_type_index, size_t capacity)
+{
+  GetRegister().used_types[cheaply_copied_type_index].queue_capacity -= capacity;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -78,6 +78,18 @@ uint32_t GetCheaplyCopiedTypeIndex(const rrlib::rtti::tType& type);
  */
 size_t GetPortCount(uint32_t cheaply_copied_type_index);
 
+/*!
+ * \param cheaply_copied_type_index 'cheaply copied type index'
+ * \return Number of connections between ports that use this type
+ */
+size_t GetConnectionCount(uint32_t cheaply_copied_type_index);
+
+/*!
+ * \param cheaply_copied_type_index 'cheaply copied type index'
+ * \return Sum of capacities of input queues of ports that use this type
+ */
+size_t GetQueueCapacity(uint32_t cheaply_copied_type_index);
+
 /*!
  * \return Number of registered 'cheaply copied' types
  */
@@ -103,6 +115,25 @@ uint32_t RegisterPort(const rrlib::rtti::tType& type);
  */
 void UnregisterPort(uint32_t cheaply_copied_type_index);
 
+/*!
+ * Register/Unregister connection between two ports that use specified 'cheaply copied' type
+ * (relevant for sizing of buffer pools)
+ *
+ * \param cheaply_copied_type_index 'Cheaply copied type index' of type that ports use
+ */
+void RegisterConnection(uint32_t cheaply_copied_type_index);
+void UnregisterConnection(uint32_t cheaply_copied_type_index);
+
+/*!
+ * Register/Unregister input queue of port that uses specified 'cheaply copied' type
+ * (relevant for sizing of buffer pools)
+ *
+ * \param cheaply_copied_type_index 'Cheaply copied type index' of type that port uses
+ * \param capacity Capacity of queue
+ */
+void RegisterQueue(uint32_t cheaply_copied_type_index, size_t capacity);
+void UnregisterQueue(uint32_t cheaply_copied_type_index, size_t capacity);
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
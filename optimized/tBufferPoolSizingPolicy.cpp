@@ -0,0 +1,100 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/optimized/tBufferPoolSizingPolicy.cpp
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/data_ports/optimized/tBufferPoolSizingPolicy.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace optimized
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*!
+ * \return Policies for global pools (index 0) and thread-local pools (index 1)
+ */
+static tBufferPoolSizingPolicy* GetPolicies()
+{
+  // Thread-local pools exist once per publishing thread - so their default maximum size is lower
+  static tBufferPoolSizingPolicy policies[2] =
+  {
+    { 2, 1, 1, 0, 1000, 50 },
+    { 1, 1, 1, 0, 50, 50 }
+  };
+  return policies;
+}
+
+const tBufferPoolSizingPolicy& GetBufferPoolSizingPolicy(bool thread_local_pools)
+{
+  return GetPolicies()[thread_local_pools ? 1 : 0];
+}
+
+void SetBufferPoolSizingPolicy(const tBufferPoolSizingPolicy& policy, bool thread_local_pools)
+{
+  GetPolicies()[thread_local_pools ? 1 : 0] = policy;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
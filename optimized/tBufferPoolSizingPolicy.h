@@ -0,0 +1,150 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/optimized/tBufferPoolSizingPolicy.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tBufferPoolSizingPolicy
+ *
+ * \b tBufferPoolSizingPolicy
+ *
+ * Determines how many buffers are allocated in buffer pools for 'cheaply copied' types.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__optimized__tBufferPoolSizingPolicy_h__
+#define __plugins__data_ports__optimized__tBufferPoolSizingPolicy_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace optimized
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Sizing policy for buffer pools
+/*!
+ * Determines the number of buffers a pool for a 'cheaply copied' type
+ * should contain - based on how the type is used in ports:
+ *
+ *   buffers = buffers_per_port * <number of ports>
+ *           + buffers_per_connection * <number of connections between ports>
+ *           + buffers_per_queue_element * <sum of input queue capacities>
+ *
+ * The result is clamped to [minimum_buffers, maximum_buffers].
+ * Pools for type index 0 (numeric::tNumber - used by most numeric ports) always contain
+ * at least minimum_buffers_number_type buffers.
+ *
+ * Pools are filled up to this size on construction and whenever PrewarmPools() is called.
+ * In order to avoid allocating memory in real-time threads, applications should call PrewarmPools()
+ * after all ports have been created and connected.
+ */
+struct tBufferPoolSizingPolicy
+{
+  /*! Buffers per port that uses type (each port holds its current value - plus buffers that are being published) */
+  size_t buffers_per_port;
+
+  /*! Buffers per connection (readers of destination ports may still hold the previous value) */
+  size_t buffers_per_connection;
+
+  /*! Buffers per element in input queues */
+  size_t buffers_per_queue_element;
+
+  /*! Minimum number of buffers in pool */
+  size_t minimum_buffers;
+
+  /*! Maximum number of buffers in pool */
+  size_t maximum_buffers;
+
+  /*! Minimum number of buffers in pool for type index 0 (numeric::tNumber) */
+  size_t minimum_buffers_number_type;
+
+  /*!
+   * \param cheaply_copied_type_index 'Cheaply copied type index' of pool's type
+   * \param port_count Number of ports that use type
+   * \param connection_count Number of connections between ports that use type
+   * \param queue_capacity Sum of capacities of input queues of ports that use type
+   * \return Number of buffers that pool should contain
+   */
+  size_t GetPoolSize(uint32_t cheaply_copied_type_index, size_t port_count, size_t connection_count, size_t queue_capacity) const
+  {
+    size_t result = buffers_per_port * port_count + buffers_per_connection * connection_count + buffers_per_queue_element * queue_capacity;
+    result = result < minimum_buffers ? minimum_buffers : result;
+    result = result > maximum_buffers ? maximum_buffers : result;
+    if (cheaply_copied_type_index == 0 && result < minimum_buffers_number_type)
+    {
+      result = minimum_buffers_number_type;
+    }
+    return result;
+  }
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+/*!
+ * \param thread_local_pools Return policy for thread-local pools? (otherwise policy for global pools is returned)
+ * \return Current sizing policy for buffer pools
+ */
+const tBufferPoolSizingPolicy& GetBufferPoolSizingPolicy(bool thread_local_pools);
+
+/*!
+ * Sets sizing policy for buffer pools.
+ * Should be called during initialization (not thread-safe) - typically before ports are created.
+ *
+ * \param policy New policy
+ * \param thread_local_pools Set policy for thread-local pools? (otherwise policy for global pools is set)
+ */
+void SetBufferPoolSizingPolicy(const tBufferPoolSizingPolicy& policy, bool thread_local_pools);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
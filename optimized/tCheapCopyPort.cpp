@@ -32,12 +32,14 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/data_ports/type_traits.h"
 #include "plugins/data_ports/common/tPullOperation.h"
+#include "plugins/data_ports/common/tStartupProfiler.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -82,6 +84,7 @@ static rrlib::rtti::tGenericObject* CreateDefaultValue(const common::tAbstractDa
     rrlib::rtti::tGenericObject* result = creation_info.data_type.CreateInstanceGeneric();
     if (creation_info.DefaultValueSet())
     {
+      common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::VALUE_DESERIALIZATION);
       rrlib::serialization::tInputStream input(creation_info.GetDefaultGeneric());
       result->Deserialize(input);
     }
@@ -99,7 +102,9 @@ tCheapCopyPort::tCheapCopyPort(common::tAbstractDataPortCreationInfo creation_in
   current_value(0),
   standard_assign(!GetFlag(tFlag::NON_STANDARD_ASSIGN) && (!GetFlag(tFlag::HAS_QUEUE))),
   input_queue(),
-  pull_request_handler(NULL)
+  pull_request_handler(NULL),
+  inline_value_size(0),
+  inline_value()
 {
   if ((!IsDataFlowType(GetDataType())) || (!IsCheaplyCopiedType(GetDataType())))
   {
@@ -124,15 +129,15 @@ tCheapCopyPort::tCheapCopyPort(common::tAbstractDataPortCreationInfo creation_in
     std::unique_ptr<rrlib::rtti::tGenericObject> object_with_default_value(GetDataType().CreateInstanceGeneric());
     initial->GetObject().DeepCopyFrom(*object_with_default_value);
   }
-
   // Initialize queue
   if (GetFlag(tFlag::HAS_QUEUE))
   {
-    input_queue.reset(new common::tPortQueue<tLockingManagerPointer>(!GetFlag(tFlag::HAS_DEQUEUE_ALL_QUEUE)));
+    input_queue.reset(new common::tPortQueue<tLockingManagerPointer>(!GetFlag(tFlag::HAS_DEQUEUE_ALL_QUEUE), *this, creation_info.queue_ring_buffer));
     if (creation_info.max_queue_size > 0)
     {
       input_queue->SetMaxQueueLength(creation_info.max_queue_size);
     }
+    RegisterQueue(cheaply_copyable_type_index, std::max(0, input_queue->GetMaxQueueLength()));
   }
 
   PropagateStrategy(NULL, NULL);  // initialize strategy
@@ -143,6 +148,11 @@ tCheapCopyPort::~tCheapCopyPort()
   tTaggedBufferPointer cur_pointer = current_value.exchange(0);
   tPortBufferUnlocker unlocker;
   unlocker(cur_pointer.GetPointer());
+  if (input_queue)
+  {
+    UnregisterQueue(cheaply_copyable_type_index, std::max(0, input_queue->GetMaxQueueLength()));
+  }
+  UnregisterPort(cheaply_copyable_type_index);
 }
 
 void tCheapCopyPort::ApplyDefaultValue()
@@ -247,6 +257,12 @@ void tCheapCopyPort::CopyCurrentValueToGenericObject(rrlib::rtti::tGenericObject
 {
   if ((strategy == tStrategy::DEFAULT && PushStrategy()) || strategy == tStrategy::NEVER_PULL)
   {
+    if (inline_value_size)
+    {
+      assert(buffer.GetType() == GetDataType());
+      CopyInlineValueRaw(buffer.GetRawDataPointer(), inline_value_size, &timestamp);
+      return;
+    }
     for (; ;)
     {
       tTaggedBufferPointer current = current_value.load();
@@ -271,7 +287,7 @@ void tCheapCopyPort::ForwardData(tAbstractDataPort& other)
 {
   assert(IsDataFlowType(other.GetDataType()) && (IsCheaplyCopiedType(other.GetDataType())));
 
-  if (tThreadLocalBufferPools::Get())
+  if (tThreadLocalBufferPools::Get() && (!inline_value_size))
   {
     tTaggedBufferPointer current_buffer = current_value.load();
     if (tThreadLocalBufferPools::Get() == current_buffer->GetThreadLocalOrigin()) // Is current thread the owner thread?
@@ -385,6 +401,7 @@ void tCheapCopyPort::InitialPushTo(tAbstractPort& target, bool reverse)
   CopyCurrentValueToManager(*unused_manager, tStrategy::NEVER_PULL);
   common::tPublishOperation<tCheapCopyPort, tPublishingDataGlobalBuffer> data(unused_manager);
   tCheapCopyPort& target_port = static_cast<tCheapCopyPort&>(target);
+  standard::tEpochReclamation::tReadGuard epoch_guard;  // listener tables are accessed without lock
   if (reverse)
   {
     common::tPublishOperation<tCheapCopyPort, tPublishingDataGlobalBuffer>::Receive<true, tChangeStatus::CHANGED_INITIAL>(data, target_port, *this);
@@ -400,7 +417,7 @@ void tCheapCopyPort::LockCurrentValueForPublishing(tPublishingDataGlobalBuffer&
   while (true)
   {
     tTaggedBufferPointer current_buffer = current_value.load();
-    if (current_buffer->GetThreadLocalOrigin())
+    if (current_buffer->GetThreadLocalOrigin() || inline_value_size)
     {
       tUnusedManagerPointer unused_manager = tUnusedManagerPointer(tGlobalBufferPools::Instance().GetUnusedBuffer(cheaply_copyable_type_index).release());
       CopyCurrentValueToManager(*unused_manager, tStrategy::NEVER_PULL);
@@ -422,6 +439,13 @@ void tCheapCopyPort::LockCurrentValueForPublishing(tPublishingDataGlobalBuffer&
 void tCheapCopyPort::LockCurrentValueForPublishing(tPublishingDataThreadLocalBuffer& publishing_data)
 {
   assert(tThreadLocalBufferPools::Get());
+  if (inline_value_size)
+  {
+    auto unused_manager = tThreadLocalBufferPools::Get()->GetUnusedBuffer(cheaply_copyable_type_index);
+    CopyCurrentValueToManager(*unused_manager, tStrategy::NEVER_PULL);
+    publishing_data.Init(unused_manager.release(), true);
+    return;
+  }
   tTaggedBufferPointer current_buffer = current_value.load();
   if (tThreadLocalBufferPools::Get() == current_buffer->GetThreadLocalOrigin()) // Is current thread the owner thread?
   {
@@ -455,7 +479,10 @@ bool tCheapCopyPort::NonStandardAssign(tPublishingDataGlobalBuffer& publishing_d
 
     // enqueue
     publishing_data.AddLock();
-    input_queue->Enqueue(tLockingManagerPointer(publishing_data.published_buffer));
+    if (input_queue->Enqueue(tLockingManagerPointer(publishing_data.published_buffer)))
+    {
+      IncrementCounter(common::tPortCounter::QUEUE_OVERFLOW);
+    }
   }
   return true;
 }
@@ -468,7 +495,10 @@ bool tCheapCopyPort::NonStandardAssign(tPublishingDataThreadLocalBuffer& publish
 
     // Enqueue
     publishing_data.AddLock();
-    input_queue->Enqueue(tLockingManagerPointer(publishing_data.published_buffer));
+    if (input_queue->Enqueue(tLockingManagerPointer(publishing_data.published_buffer)))
+    {
+      IncrementCounter(common::tPortCounter::QUEUE_OVERFLOW);
+    }
   }
   return true;
 }
@@ -489,6 +519,32 @@ tCheapCopyPort::tLockingManagerPointer tCheapCopyPort::PullValueRaw(bool ignore_
   }
 }
 
+void tCheapCopyPort::OnConnect(tAbstractPort& partner, bool partner_is_destination)
+{
+  common::tAbstractDataPort::OnConnect(partner, partner_is_destination);
+  if (partner_is_destination)
+  {
+    RegisterConnection(cheaply_copyable_type_index);
+  }
+  else if (input_queue)
+  {
+    input_queue->UpdateSourceCount(1);
+  }
+}
+
+void tCheapCopyPort::OnDisconnect(tAbstractPort& partner, bool partner_is_destination)
+{
+  common::tAbstractDataPort::OnDisconnect(partner, partner_is_destination);
+  if (partner_is_destination)
+  {
+    UnregisterConnection(cheaply_copyable_type_index);
+  }
+  else if (input_queue)
+  {
+    input_queue->UpdateSourceCount(-1);
+  }
+}
+
 void tCheapCopyPort::SetDefault(rrlib::rtti::tGenericObject& new_default)
 {
   if (IsReady())
@@ -515,6 +571,10 @@ void tCheapCopyPort::SetDefault(rrlib::rtti::tGenericObject& new_default)
 
   tTaggedBufferPointer cur_pointer = current_value.load();
   cur_pointer->GetObject().DeepCopyFrom(*default_value);
+  if (inline_value_size)
+  {
+    StoreInlineValue(*cur_pointer, LockInlineValue());
+  }
 }
 
 //void tCheapCopyPort::SetMaxQueueLengthImpl(int length)
@@ -525,6 +585,34 @@ void tCheapCopyPort::SetDefault(rrlib::rtti::tGenericObject& new_default)
 //  queue->SetMaxLength(length);
 //}
 
+void tCheapCopyPort::SetInlineCurrentValue(bool inline_current_value)
+{
+  if (IsReady())
+  {
+    FINROC_LOG_PRINT(ERROR, "Storing current value inline may only be enabled or disabled before port is initialized. Ignoring.");
+    return;
+  }
+  if (inline_current_value && GetDataType().GetSize() > cMAX_INLINE_VALUE_SIZE)
+  {
+    FINROC_LOG_PRINT(ERROR, "Data type ", GetDataType().GetName(), " is too large to be stored inline (maximum is ", static_cast<int>(cMAX_INLINE_VALUE_SIZE), " bytes). Ignoring.");
+    return;
+  }
+  tTaggedBufferPointer cur_pointer = current_value.load();
+  if (inline_current_value && (!inline_value_size))
+  {
+    inline_value_size = GetDataType().GetSize();
+    StoreInlineValue(*cur_pointer, LockInlineValue());
+  }
+  else if ((!inline_current_value) && inline_value_size)
+  {
+    // copy inline value back to buffer
+    rrlib::time::tTimestamp timestamp;
+    CopyInlineValueRaw(cur_pointer->GetObject().GetRawDataPointer(), inline_value_size, &timestamp);
+    cur_pointer->SetTimestamp(timestamp);
+    inline_value_size = 0;
+  }
+}
+
 void tCheapCopyPort::SetPullRequestHandler(tPullRequestHandlerRaw* pull_request_handler_)
 {
   if (pull_request_handler_ != NULL)
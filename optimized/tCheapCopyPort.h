@@ -38,6 +38,9 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <cstring>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -80,6 +83,9 @@ namespace optimized
 /*!
  * Port implementation with improved performance characteristics for 'cheaply copied' data types.
  *
+ * For data types of up to 16 bytes, ports may optionally store their current value inline
+ * (protected by a sequence lock - see SetInlineCurrentValue()).
+ *
  * Convention: Protected Methods do not perform any necessary synchronization
  * with respect to concurrency.
  * Methods in the public interface need to make sure they perform the necessary means.
@@ -91,40 +97,46 @@ class tCheapCopyPort : public common::tAbstractDataPort
   template<typename T>
   friend class finroc::data_ports::tPort;
 
-  typedef rrlib::util::tTaggedPointer<tCheaplyCopiedBufferManager, true, 3> tTaggedBufferPointer;
+  typedef rrlib::util::tTaggedPointer<tCheaplyCopiedBufferManager, true, tCheaplyCopiedBufferManager::cTAG_BITS> tTaggedBufferPointer;
 
   struct tPortBufferUnlocker
   {
     void operator()(tCheaplyCopiedBufferManager* p) const
+    {
+      ReleaseLocks(p, 1);
+    }
+
+    void operator()(tThreadLocalBufferManager* p) const
+    {
+      assert(tThreadLocalBufferPools::Get());
+      ReleaseLocks(p, 1);
+    }
+
+    /*!
+     * Releases several locks on a buffer at once
+     * (with a single atomic operation - or a single thread-local counter update)
+     *
+     * \param p Buffer to release locks of
+     * \param lock_count Number of locks to release
+     */
+    static void ReleaseLocks(tCheaplyCopiedBufferManager* p, int lock_count)
     {
       tThreadLocalBufferPools* origin = p->GetThreadLocalOrigin();
       if (origin)
       {
         if (origin == tThreadLocalBufferPools::Get()) // Is current thread the owner?
         {
-          static_cast<tThreadLocalBufferManager*>(p)->ReleaseThreadLocalLocks<tThreadSpecificBufferPools<false>::tBufferPointer::deleter_type>(1);
+          static_cast<tThreadLocalBufferManager*>(p)->ReleaseThreadLocalLocks<tThreadSpecificBufferPools<false>::tBufferPointer::deleter_type>(lock_count);
         }
         else
         {
-          static_cast<tThreadLocalBufferManager*>(p)->ReleaseLocksFromOtherThread(1);
+          static_cast<tThreadLocalBufferManager*>(p)->ReleaseLocksFromOtherThread(lock_count);
         }
       }
       else
       {
-        p->ReleaseLocks<typename tGlobalBufferPools::tBufferPointer::deleter_type, tCheaplyCopiedBufferManager>(1);
-      }
-    }
-
-    void operator()(tThreadLocalBufferManager* p) const
-    {
-      assert(tThreadLocalBufferPools::Get());
-      if (p->GetThreadLocalOrigin() == tThreadLocalBufferPools::Get()) // Is current thread the owner?
-      {
-        p->ReleaseThreadLocalLocks<typename tThreadLocalBufferPools::tBufferPointer::deleter_type>(1);
-      }
-      else
-      {
-        p->ReleaseLocksFromOtherThread(1);
+        tGlobalBufferPools::CountCrossNodeAccess(*p);
+        p->ReleaseLocks<typename tGlobalBufferPools::tBufferPointer::deleter_type, tCheaplyCopiedBufferManager>(lock_count);
       }
     }
   };
@@ -224,6 +236,11 @@ public:
   {
     if ((strategy == tStrategy::DEFAULT && PushStrategy()) || strategy == tStrategy::NEVER_PULL)
     {
+      if (sizeof(T) <= cMAX_INLINE_VALUE_SIZE && inline_value_size)
+      {
+        CopyInlineValue(buffer, NULL);
+        return;
+      }
       for (; ;)
       {
         tTaggedBufferPointer current = current_value.load();
@@ -254,6 +271,11 @@ public:
   {
     if ((strategy == tStrategy::DEFAULT && PushStrategy()) || strategy == tStrategy::NEVER_PULL)
     {
+      if (sizeof(T) <= cMAX_INLINE_VALUE_SIZE && inline_value_size)
+      {
+        CopyInlineValue(buffer, &timestamp);
+        return;
+      }
       for (; ;)
       {
         tTaggedBufferPointer current = current_value.load();
@@ -320,6 +342,14 @@ public:
     return default_value.get();
   }
 
+  /*!
+   * \return Does port store its current value inline? (see SetInlineCurrentValue())
+   */
+  bool GetInlineCurrentValue() const
+  {
+    return inline_value_size;
+  }
+
   /*!
    * \param never_pull Do not attempt to pull data - even if port is on push strategy
    * \return Current locked port data buffer
@@ -396,11 +426,62 @@ public:
 //    Publish(tThreadLocalCache::GetFast(), buffer);
 //  }
 
+  /*!
+   * Releases several locks on a buffer at once.
+   * When many locked buffers are processed (e.g. a queue fragment), locks of the same buffer
+   * can be accumulated and released with a single atomic operation.
+   *
+   * \param buffer Buffer to release locks of
+   * \param lock_count Number of locks to release
+   */
+  static void ReleaseLocks(tCheaplyCopiedBufferManager* buffer, int lock_count)
+  {
+    tPortBufferUnlocker::ReleaseLocks(buffer, lock_count);
+  }
+
+  /*!
+   * Publishes value by writing it directly to the port's inline value (see SetInlineCurrentValue()) -
+   * without obtaining a buffer from any pool or executing a publishing operation.
+   * This is only possible if nothing else requires a buffer: the port must store its current value inline,
+   * must have standard assignment (no bounds, no queue), no listeners and no outgoing connections.
+   *
+   * \param data Raw data of value to publish (size of port's data type)
+   * \param timestamp Timestamp of value
+   * 
+eturn True if value was published - false if value needs to be published using a buffer
+   */
+  inline bool TryPublishInline(const void* data, const rrlib::time::tTimestamp& timestamp)
+  {
+    if ((!inline_value_size) || (!standard_assign) || (GetAllFlags().Raw() & common::cRAW_FLAGS_READY_AND_HIJACKED) != common::cRAW_FLAG_READY ||
+        GetPortListeners() || OutgoingConnectionsBegin() != OutgoingConnectionsEnd())
+    {
+      return false;
+    }
+    StoreInlineValueRaw(data, timestamp, LockInlineValue());
+    IncrementCounter(common::tPortCounter::PUBLISH);
+    return true;
+  }
+
   /*!
    * \param New default value for port
    */
   void SetDefault(rrlib::rtti::tGenericObject& new_default);
 
+  /*!
+   * Enables or disables storing the current value inline in the port (only possible for data types of up to 16 bytes).
+   * In this mode, publishing stores the value in the port (protected by a sequence lock) -
+   * instead of exchanging the current buffer and adjusting reference counters.
+   * Get operations copy the value from there without accessing any buffers.
+   * Operations that require a buffer (e.g. GetPointer()) copy the current value to an unused buffer.
+   * Ports without queue, listeners and outgoing connections publish without obtaining any buffer (see TryPublishInline()).
+   * Suitable for ports with small data types that are mostly accessed by value.
+   *
+   * May only be called before port is initialized.
+   *
+   * \param inline_current_value Whether to store current value inline
+   */
+  void SetInlineCurrentValue(bool inline_current_value);
+
   /*!
    * \param pull_request_handler Object that handles pull requests - null if there is none (typical case)
    */
@@ -425,31 +506,45 @@ public:
    */
   struct tPublishingDataGlobalBuffer : public tPublishingDataCommon
   {
-    /*! Number of locks already added to reference counter for current publishing operation */
-    enum { cADD_LOCKS = 1000 };
+    /*! Number of locks added to reference counter for publishing operations without push plan */
+    enum { cADD_LOCKS = tAbstractDataPort::cDEFAULT_PUBLISH_LOCKS };
 
     /*! Pointer to port data used in current publishing operation */
     tCheaplyCopiedBufferManager* published_buffer;
 
+    /*! Number of locks already added to reference counter for current publishing operation */
+    int added_locks;
+
     /*! Number of locks that were required for assignments etc. */
     int used_locks;
 
     /*! Counter to use */
     int* used_locks_counter_to_use;
 
-    tPublishingDataGlobalBuffer(tUnusedManagerPointer& published) :
+    /*! Counter of added locks to use (copies created in tPublishOperation::Receive() use the one of the original) */
+    int* added_locks_counter_to_use;
+
+    /*!
+     * \param published Buffer to publish
+     * \param add_locks Number of locks to add to reference counter (see tAbstractDataPort::GetPublishLockCount())
+     */
+    tPublishingDataGlobalBuffer(tUnusedManagerPointer& published, int add_locks = cADD_LOCKS) :
       published_buffer(published.get()),
+      added_locks(add_locks),
       used_locks(0),
-      used_locks_counter_to_use(&used_locks)
+      used_locks_counter_to_use(&used_locks),
+      added_locks_counter_to_use(&added_locks)
     {
-      int pointer_tag = published->InitReferenceCounter(cADD_LOCKS);
+      int pointer_tag = published->InitReferenceCounter(added_locks);
       published_buffer_tagged_pointer = tTaggedBufferPointer(published.release(), pointer_tag);
     }
 
     tPublishingDataGlobalBuffer() :
       published_buffer(NULL),
+      added_locks(cADD_LOCKS),
       used_locks(0),
-      used_locks_counter_to_use(&used_locks)
+      used_locks_counter_to_use(&used_locks),
+      added_locks_counter_to_use(&added_locks)
     {
       published_buffer_tagged_pointer = 0;
     }
@@ -474,8 +569,11 @@ public:
     {
       if (published_buffer && (!IsCopy()))
       {
-        assert((used_locks < cADD_LOCKS) && "Too many locks in this publishing operation");
-        published_buffer->ReleaseLocks<tUnusedManagerPointer::deleter_type, tCheaplyCopiedBufferManager>(cADD_LOCKS - used_locks);
+        assert((used_locks <= added_locks) && "Too many locks in this publishing operation");
+        if (used_locks < added_locks)
+        {
+          published_buffer->ReleaseLocks<tUnusedManagerPointer::deleter_type, tCheaplyCopiedBufferManager>(added_locks - used_locks);
+        }
         published_buffer = NULL;
       }
     }
@@ -486,10 +584,12 @@ public:
     void Init(tUnusedManagerPointer& published)
     {
       CheckRecycle();
+      added_locks = cADD_LOCKS;
       used_locks = 0;
       used_locks_counter_to_use = &used_locks;
+      added_locks_counter_to_use = &added_locks;
       published_buffer = published.get();
-      int pointer_tag = published->InitReferenceCounter(cADD_LOCKS);
+      int pointer_tag = published->InitReferenceCounter(added_locks);
       published_buffer_tagged_pointer = tTaggedBufferPointer(published.release(), pointer_tag);
     }
 
@@ -499,8 +599,10 @@ public:
     void InitSuccessfullyLocked(tCheaplyCopiedBufferManager* published)
     {
       CheckRecycle();
+      added_locks = cADD_LOCKS;
       used_locks = 0;
       used_locks_counter_to_use = &used_locks;
+      added_locks_counter_to_use = &added_locks;
       published_buffer = published;
       published_buffer_tagged_pointer = tTaggedBufferPointer(published, published->GetPointerTag());
     }
@@ -518,6 +620,24 @@ public:
       return (*used_locks_counter_to_use);
     }
 
+    /*!
+     * Makes sure that enough locks were added to the reference counter for the specified number of further locks.
+     * If not, more locks are added - so that this is rarely necessary again in the current publishing operation.
+     * The publishing operation always keeps one lock - so that buffer cannot be recycled before it has completed.
+     *
+     * \param lock_count Maximum number of locks that are about to be used
+     */
+    inline void ReserveLocks(int lock_count)
+    {
+      int& added = *added_locks_counter_to_use;
+      if ((*used_locks_counter_to_use) + lock_count >= added)
+      {
+        int additional_locks = std::max(lock_count, added);
+        published_buffer->AddLocks(additional_locks, published_buffer_tagged_pointer.GetStamp());
+        added += additional_locks;
+      }
+    }
+
   };
 
   /*!
@@ -529,28 +649,43 @@ public:
     /*! Pointer to port data used in current publishing operation */
     tThreadLocalBufferManager* published_buffer;
 
+    /*! Is this a copy of the publishing data created in tPublishOperation::Receive()? */
+    bool is_copy;
+
     tPublishingDataThreadLocalBuffer(tUnusedManagerPointer& published) :
-      published_buffer(static_cast<tThreadLocalBufferManager*>(published.get()))
+      published_buffer(static_cast<tThreadLocalBufferManager*>(published.get())),
+      is_copy(false)
     {
       int pointer_tag = published_buffer->IncrementReuseCounter();
       published_buffer_tagged_pointer = tTaggedBufferPointer(published.release(), pointer_tag);
     }
 
     tPublishingDataThreadLocalBuffer(tThreadLocalBufferManager* published, bool unused) :
-      published_buffer(published)
+      published_buffer(published),
+      is_copy(false)
     {
       int pointer_tag = unused ? published->IncrementReuseCounter() : published->GetPointerTag();
       published_buffer_tagged_pointer = tTaggedBufferPointer(published, pointer_tag);
     }
 
-    tPublishingDataThreadLocalBuffer() : published_buffer(NULL)
+    tPublishingDataThreadLocalBuffer() : published_buffer(NULL), is_copy(false)
     {
       published_buffer_tagged_pointer = 0;
     }
 
+    tPublishingDataThreadLocalBuffer(const tPublishingDataThreadLocalBuffer& other) :
+      tPublishingDataCommon(other),
+      published_buffer(other.published_buffer),
+      is_copy(true)
+    {}
+
+    // Recycles buffer if it was not assigned (only occurs if all receiving ports store their current value inline)
     ~tPublishingDataThreadLocalBuffer()
     {
-      assert(((!published_buffer) || AlreadyAssigned()) && "Due to advantages w.r.t. computational overhead, buffers should always be assigned");
+      if (!is_copy)
+      {
+        CheckRecycle();
+      }
     }
 
     inline void AddLock()
@@ -599,6 +734,12 @@ public:
     {
       return published_buffer->ThreadLocalReferenceCounter();
     }
+
+    /*!
+     * Thread-local locks are not reserved in advance (see tPublishingDataGlobalBuffer::ReserveLocks())
+     */
+    inline void ReserveLocks(int lock_count)
+    {}
   };
 
 //----------------------------------------------------------------------
@@ -611,10 +752,12 @@ protected:
    */
   tUnusedManagerPointer GetUnusedBuffer(tPublishingDataGlobalBuffer& publishing_data)
   {
+    common::tAllocationMonitor::tPortScope allocation_scope(*this);
     return tUnusedManagerPointer(tGlobalBufferPools::Instance().GetUnusedBuffer(cheaply_copyable_type_index).release());
   }
   tUnusedManagerPointer GetUnusedBuffer(tPublishingDataThreadLocalBuffer& publishing_data)
   {
+    common::tAllocationMonitor::tPortScope allocation_scope(*this);
     return tUnusedManagerPointer(tThreadLocalBufferPools::Get()->GetUnusedBuffer(cheaply_copyable_type_index).release());
   }
 
@@ -691,6 +834,32 @@ private:
   /*! Object that handles pull requests - null if there is none (typical case) */
   tPullRequestHandlerRaw* pull_request_handler;
 
+  /*! Maximum size of data types whose current value is additionally stored inline in port */
+  enum { cMAX_INLINE_VALUE_SIZE = 16 };
+
+  /*!
+   * Copy of current value stored inline in port - protected by a sequence lock.
+   * Readers copy value from here without touching the buffer (manager) in current_value.
+   * This way, readers on other cores do not contend on buffer cache lines.
+   */
+  struct tInlineValue
+  {
+    /*! Sequence counter - odd while value is written */
+    std::atomic<uint32_t> sequence;
+
+    /*! Raw data of current value */
+    std::array<std::atomic<uint64_t>, cMAX_INLINE_VALUE_SIZE / 8> data;
+
+    /*! Timestamp of current value (ticks since epoch) */
+    std::atomic<rrlib::time::tTimestamp::duration::rep> timestamp;
+  };
+
+  /*! Size of inline value in bytes - 0 if current value is not stored inline (see SetInlineCurrentValue()) */
+  uint32_t inline_value_size;
+
+  /*! Current value stored inline (only used if inline_value_size is not 0) - buffer in current_value is not updated then */
+  tInlineValue inline_value;
+
 
   /*!
    * Publishes new data to port.
@@ -713,6 +882,13 @@ private:
       }
     }
 
+    if (inline_value_size)
+    {
+      // store value - no buffer exchange or locks required
+      StoreInlineValue(*publishing_data.published_buffer, LockInlineValue());
+      return true;
+    }
+
     // assign anyway
     publishing_data.AddLock();
     tTaggedBufferPointer old = current_value.exchange(publishing_data.published_buffer_tagged_pointer);
@@ -721,6 +897,99 @@ private:
     return true;
   }
 
+  /*!
+   * Copies current value from inline value
+   *
+   * \param buffer Buffer to copy current value to
+   * \param timestamp Buffer to copy current timestamp to (optional - may be NULL)
+   */
+  template <typename T>
+  inline void CopyInlineValue(T& buffer, rrlib::time::tTimestamp* timestamp)
+  {
+    CopyInlineValueRaw(&buffer, std::min(sizeof(T), static_cast<size_t>(cMAX_INLINE_VALUE_SIZE)), timestamp);
+  }
+
+  /*!
+   * Copies current value from inline value
+   *
+   * \param buffer Memory to copy current value to
+   * \param size Number of bytes to copy
+   * \param timestamp Buffer to copy current timestamp to (optional - may be NULL)
+   */
+  inline void CopyInlineValueRaw(void* buffer, size_t size, rrlib::time::tTimestamp* timestamp)
+  {
+    std::array<uint64_t, cMAX_INLINE_VALUE_SIZE / 8> raw;
+    for (; ;)
+    {
+      uint32_t sequence = inline_value.sequence.load(std::memory_order_acquire);
+      if (sequence & 1)
+      {
+        continue;
+      }
+      for (size_t i = 0; i < raw.size(); i++)
+      {
+        raw[i] = inline_value.data[i].load(std::memory_order_relaxed);
+      }
+      rrlib::time::tTimestamp::duration::rep timestamp_ticks = inline_value.timestamp.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence == inline_value.sequence.load(std::memory_order_relaxed))    // still valid??
+      {
+        memcpy(buffer, raw.data(), size);
+        if (timestamp)
+        {
+          *timestamp = rrlib::time::tTimestamp(rrlib::time::tTimestamp::duration(timestamp_ticks));
+        }
+        return;
+      }
+    }
+  }
+
+  /*!
+   * Acquires exclusive write access to inline value (spins while another publisher writes)
+   *
+   * \return Sequence counter value while locked (odd)
+   */
+  inline uint32_t LockInlineValue()
+  {
+    uint32_t sequence = inline_value.sequence.load(std::memory_order_relaxed);
+    while ((sequence & 1) || (!inline_value.sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire)))
+    {
+      sequence = inline_value.sequence.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    return sequence + 1;
+  }
+
+  /*!
+   * Stores value of specified buffer in inline value and releases write access
+   *
+   * \param buffer Buffer whose value to store
+   * \param sequence Sequence counter value returned by LockInlineValue()
+   */
+  inline void StoreInlineValue(tCheaplyCopiedBufferManager& buffer, uint32_t sequence)
+  {
+    StoreInlineValueRaw(buffer.GetObject().GetRawDataPointer(), buffer.GetTimestamp(), sequence);
+  }
+
+  /*!
+   * Stores specified value in inline value and releases write access
+   *
+   * \param data Raw data of value to store (inline_value_size bytes are copied)
+   * \param timestamp Timestamp of value
+   * \param sequence Sequence counter value returned by LockInlineValue()
+   */
+  inline void StoreInlineValueRaw(const void* data, const rrlib::time::tTimestamp& timestamp, uint32_t sequence)
+  {
+    std::array<uint64_t, cMAX_INLINE_VALUE_SIZE / 8> raw = {};
+    memcpy(raw.data(), data, inline_value_size);
+    for (size_t i = 0; i < raw.size(); i++)
+    {
+      inline_value.data[i].store(raw[i], std::memory_order_relaxed);
+    }
+    inline_value.timestamp.store(timestamp.time_since_epoch().count(), std::memory_order_relaxed);
+    inline_value.sequence.store(sequence + 1, std::memory_order_release);
+  }
+
   /*!
    * Calls pull request handler
    *
@@ -816,6 +1085,10 @@ private:
 
   virtual void InitialPushTo(tAbstractPort& target, bool reverse) override;
 
+  virtual void OnConnect(tAbstractPort& partner, bool partner_is_destination) override;
+
+  virtual void OnDisconnect(tAbstractPort& partner, bool partner_is_destination) override;
+
   /*!
    * Notify any port listeners of data change
    *
@@ -824,10 +1097,11 @@ private:
   template <tChangeStatus CHANGE_CONSTANT, typename TPublishingData>
   inline void NotifyListeners(TPublishingData& publishing_data)
   {
-    if (GetPortListener())
+    const common::tPortListenerTable* listeners = GetPortListeners();
+    if (listeners)
     {
       tChangeContext change_context(*this, publishing_data.published_buffer->GetTimestamp(), CHANGE_CONSTANT);
-      GetPortListener()->PortChangedRaw(change_context, publishing_data.ReferenceCounter(), *publishing_data.published_buffer);
+      listeners->Dispatch(change_context, publishing_data.ReferenceCounter(), *publishing_data.published_buffer);
     }
   }
 
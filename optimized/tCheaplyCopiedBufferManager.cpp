@@ -36,6 +36,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/optimized/tGlobalBufferPools.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -71,6 +72,7 @@ namespace optimized
 tCheaplyCopiedBufferManager::tCheaplyCopiedBufferManager(tThreadLocalBufferPools* origin) :
   reference_counter(0),
   reuse_counter(0),
+  numa_node(tGlobalBufferPools::GetCurrentNumaNode()),
   origin(origin)
 {}
 
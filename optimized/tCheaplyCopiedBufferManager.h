@@ -99,6 +99,14 @@ public:
     return reinterpret_cast<rrlib::rtti::tGenericObject&>(*(this + 1));
   }
 
+  /*!
+   * \return NUMA node of thread that created this buffer (and on which its memory was typically placed)
+   */
+  uint32_t GetNumaNode() const
+  {
+    return numa_node;
+  }
+
   /*!
    * \return Buffer pools, this buffer originates from. Null if it's a global buffer.
    * Non-NULL indicates that this is actually an object of the subclass tThreadLocalBufferManager
@@ -131,6 +139,9 @@ protected:
 //----------------------------------------------------------------------
 private:
 
+  /*! NUMA node of thread that created this buffer (fits into padding before 'origin') */
+  const uint32_t numa_node;
+
   /*! Buffer pools, this buffer originates from. Null if it's a global buffer. */
   tThreadLocalBufferPools* const origin;
 
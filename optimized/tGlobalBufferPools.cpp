@@ -32,6 +32,15 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "rrlib/thread/tLock.h"
+#include "core/log_messages.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -84,16 +93,187 @@ struct tGlobalBufferPoolsInit
 
 static tGlobalBufferPoolsInit init_global_buffer_pools;
 
+/*!
+ * \return Number of NUMA nodes in system (1 if it cannot be determined)
+ */
+static uint32_t QueryNumaNodeCount()
+{
+  // Format of file is e.g. "0" or "0-1"
+  std::ifstream possible_nodes("/sys/devices/system/node/possible");
+  std::string nodes;
+  if (!(possible_nodes >> nodes))
+  {
+    return 1;
+  }
+  size_t separator = nodes.find_last_of("-,");
+  uint32_t max_node = static_cast<uint32_t>(std::atoi(nodes.c_str() + (separator == std::string::npos ? 0 : separator + 1)));
+  return std::min<uint32_t>(max_node + 1, tGlobalBufferPools::cMAX_NUMA_NODES);
+}
+
+/*!
+ * \param numa_node NUMA node
+ * \param cpus Set to fill with CPUs of NUMA node
+ * \return Whether CPUs of NUMA node could be determined
+ */
+static bool GetNumaNodeCpus(uint32_t numa_node, cpu_set_t& cpus)
+{
+  // Format of file is e.g. "0-3,8-11"
+  std::ifstream cpu_list("/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+  std::string ranges;
+  if (!(cpu_list >> ranges))
+  {
+    return false;
+  }
+  CPU_ZERO(&cpus);
+  bool cpu_found = false;
+  size_t position = 0;
+  while (position < ranges.length())
+  {
+    size_t range_end = ranges.find(',', position);
+    std::string range = ranges.substr(position, range_end == std::string::npos ? std::string::npos : range_end - position);
+    size_t separator = range.find('-');
+    int first = std::atoi(range.c_str());
+    int last = separator == std::string::npos ? first : std::atoi(range.c_str() + separator + 1);
+    for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++)
+    {
+      CPU_SET(cpu, &cpus);
+      cpu_found = true;
+    }
+    position = range_end == std::string::npos ? ranges.length() : range_end + 1;
+  }
+  return cpu_found;
+}
+
+/*!
+ * \return Mutex for creating instances for NUMA nodes
+ */
+static rrlib::thread::tMutex& GetInstanceMutex()
+{
+  static rrlib::thread::tMutex mutex;
+  return mutex;
+}
+
 tGlobalBufferPools* tGlobalBufferPools::instance = NULL;
+std::atomic<tGlobalBufferPools*> tGlobalBufferPools::instances[cMAX_NUMA_NODES];
+std::atomic<uint32_t> tGlobalBufferPools::numa_node_count(0);
+__thread tGlobalBufferPools* tGlobalBufferPools::current_thread_instance = NULL;
+__thread int tGlobalBufferPools::current_thread_numa_node = -1;
 
-tGlobalBufferPools::tGlobalBufferPools()
+tGlobalBufferPools::tGlobalBufferPools() :
+  tGlobalBufferPools(GetCurrentNumaNode())
 {
   instance = this;
 }
 
+tGlobalBufferPools::tGlobalBufferPools(uint32_t numa_node) :
+  numa_node(numa_node),
+  cross_node_accesses(0)
+{
+  instances[numa_node] = this;
+}
+
 tGlobalBufferPools::~tGlobalBufferPools()
 {
-  instance = NULL;
+  instances[numa_node] = NULL;
+  if (this == instance)
+  {
+    for (size_t i = 0; i < cMAX_NUMA_NODES; i++)
+    {
+      delete instances[i].load();
+    }
+    instance = NULL;
+  }
+}
+
+uint32_t tGlobalBufferPools::DetermineCurrentNumaNode()
+{
+  static std::once_flag numa_node_count_determined;
+  std::call_once(numa_node_count_determined, []()
+  {
+    numa_node_count.store(QueryNumaNodeCount());
+  });
+  uint32_t node_count = numa_node_count.load(std::memory_order_relaxed);
+  uint32_t node = 0;
+#ifdef SYS_getcpu
+  if (node_count > 1)
+  {
+    unsigned int cpu = 0, current_node = 0;
+    if (syscall(SYS_getcpu, &cpu, &current_node, NULL) == 0)
+    {
+      node = std::min<uint32_t>(current_node, node_count - 1);
+    }
+  }
+#endif
+  current_thread_numa_node = static_cast<int>(node);
+  return node;
+}
+
+tGlobalBufferPools& tGlobalBufferPools::GetOrCreateInstance(uint32_t numa_node)
+{
+  if (!instances[numa_node])
+  {
+    rrlib::thread::tLock lock(GetInstanceMutex());
+    if (!instances[numa_node])
+    {
+      new tGlobalBufferPools(numa_node);  // owned by singleton instance; buffers are first touched by calling thread
+    }
+  }
+  return *instances[numa_node].load();
+}
+
+void tGlobalBufferPools::LogNumaStatistics()
+{
+  for (uint32_t i = 0; i < GetNumaNodeCount(); i++)
+  {
+    tGlobalBufferPools* pools = instances[i].load();
+    if (pools)
+    {
+      FINROC_LOG_PRINT_STATIC(USER, "Global buffer pools of NUMA node ", i, ": ", pools->GetCrossNodeAccessCount(), " cross-node accesses, ", pools->GetTotalMissCount(), " pool misses");
+    }
+  }
+}
+
+size_t tGlobalBufferPools::PrewarmAllNumaNodes()
+{
+  int thread_numa_node = static_cast<int>(GetCurrentNumaNode());
+  uint32_t node_count = GetNumaNodeCount();
+  cpu_set_t thread_affinity;
+  bool bind_to_nodes = node_count > 1 && sched_getaffinity(0, sizeof(thread_affinity), &thread_affinity) == 0;
+  size_t allocated = 0;
+  for (uint32_t node = 0; node < node_count; node++)
+  {
+    cpu_set_t node_cpus;
+    if (bind_to_nodes && GetNumaNodeCpus(node, node_cpus) && sched_setaffinity(0, sizeof(node_cpus), &node_cpus) != 0)
+    {
+      FINROC_LOG_PRINT_STATIC(WARNING, "Could not bind thread to CPUs of NUMA node ", node, ". Buffers of this node are allocated in memory of thread's node.");
+    }
+    current_thread_numa_node = static_cast<int>(node);  // buffers are attributed to node
+    allocated += GetOrCreateInstance(node).PrewarmPools();
+  }
+  if (bind_to_nodes)
+  {
+    sched_setaffinity(0, sizeof(thread_affinity), &thread_affinity);
+  }
+  current_thread_numa_node = thread_numa_node;
+  return allocated;
+}
+
+void tGlobalBufferPools::ResetCrossNodeAccessCounts()
+{
+  for (uint32_t i = 0; i < cMAX_NUMA_NODES; i++)
+  {
+    tGlobalBufferPools* pools = instances[i].load();
+    if (pools)
+    {
+      pools->cross_node_accesses.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+tGlobalBufferPools& tGlobalBufferPools::UpdateCurrentNumaNode()
+{
+  current_thread_instance = &GetOrCreateInstance(DetermineCurrentNumaNode());
+  return *current_thread_instance;
 }
 
 //----------------------------------------------------------------------
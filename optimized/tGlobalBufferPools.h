@@ -65,6 +65,19 @@ namespace optimized
 //! Global buffer pools
 /*!
  * Global set of buffer pools for 'cheaply copied' types.
+ *
+ * On NUMA systems, there is one instance per NUMA node.
+ * Instance() returns the instance of the calling thread's node - so buffers are typically
+ * served from memory local to the publishing thread: Buffers are created by threads of the
+ * respective node, so their memory is placed on this node by the OS' first-touch policy.
+ * The node of a thread is determined on its first call to Instance(). Threads that are pinned
+ * to another node later should call UpdateCurrentNumaNode().
+ * Releasing locks on a global buffer (i.e. after reading it) from a thread on another node is counted as cross-node access
+ * (see GetCrossNodeAccessCount() and LogNumaStatistics()).
+ *
+ * Applications with real-time requirements should call PrewarmAllNumaNodes()
+ * after all ports have been created and connected (see tBufferPoolSizingPolicy).
+ * GetPoolStatistics() and GetTotalMissCount() tell whether buffers still needed to be allocated later.
  */
 class tGlobalBufferPools : public tThreadSpecificBufferPools < !definitions::cSINGLE_THREADED >
 {
@@ -74,14 +87,108 @@ class tGlobalBufferPools : public tThreadSpecificBufferPools < !definitions::cSI
 //----------------------------------------------------------------------
 public:
 
+  /*! Maximum number of NUMA nodes with separate buffer pools (threads on nodes with higher index use the last pools) */
+  enum { cMAX_NUMA_NODES = 8 };
+
+  /*!
+   * Counts access to buffer if it originates from another NUMA node than the calling thread's node
+   * (called when a thread releases locks on a global buffer)
+   *
+   * \param buffer Buffer that is accessed
+   */
+  static inline void CountCrossNodeAccess(const tCheaplyCopiedBufferManager& buffer)
+  {
+    if (numa_node_count.load(std::memory_order_relaxed) > 1 && buffer.GetNumaNode() != GetCurrentNumaNode())
+    {
+      Instance().cross_node_accesses.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /*!
+   * \return Number of accesses from threads on this instance's NUMA node to buffers from other nodes
+   */
+  size_t GetCrossNodeAccessCount() const
+  {
+    return cross_node_accesses.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \return NUMA node of calling thread (as determined on thread's first call to Instance() or UpdateCurrentNumaNode())
+   */
+  static inline uint32_t GetCurrentNumaNode()
+  {
+    int node = current_thread_numa_node;
+    return node >= 0 ? static_cast<uint32_t>(node) : DetermineCurrentNumaNode();
+  }
+
+  /*!
+   * \param numa_node NUMA node
+   * \return Instance for specified node (NULL if no thread on this node has obtained buffer pools yet)
+   */
+  static tGlobalBufferPools* GetInstanceForNumaNode(uint32_t numa_node)
+  {
+    return numa_node < cMAX_NUMA_NODES ? instances[numa_node].load() : NULL;
+  }
+
+  /*!
+   * \return NUMA node of this instance
+   */
+  uint32_t GetNumaNode() const
+  {
+    return numa_node;
+  }
+
+  /*!
+   * \return Number of NUMA nodes in system (as far as relevant for buffer pools - at most cMAX_NUMA_NODES)
+   */
+  static uint32_t GetNumaNodeCount()
+  {
+    return numa_node_count.load(std::memory_order_relaxed);
+  }
+
   /*!
-   * \return Singleton instance
+   * \return Instance for calling thread's NUMA node
    */
   static tGlobalBufferPools& Instance()
   {
-    return *instance;
+    tGlobalBufferPools* result = current_thread_instance;
+    if (!result)
+    {
+      result = &UpdateCurrentNumaNode();
+    }
+    return *result;
   }
 
+  /*!
+   * Prints cross-node access counts and pool statistics of all NUMA nodes to log
+   */
+  static void LogNumaStatistics();
+
+  /*!
+   * Creates instances for all NUMA nodes (if they do not exist yet) and prewarms their pools (see PrewarmPools()).
+   * While prewarming the pools of a node, the calling thread is temporarily bound to this node's CPUs -
+   * so that buffers are placed in memory of this node.
+   * Should be called after all ports have been created and connected - so that the first publishing
+   * operations of (real-time) threads on any node neither need to create pools nor allocate buffers.
+   *
+   * \return Number of buffers that were allocated
+   */
+  static size_t PrewarmAllNumaNodes();
+
+  /*!
+   * Resets cross-node access counters of all NUMA nodes to zero
+   */
+  static void ResetCrossNodeAccessCounts();
+
+  /*!
+   * Determines NUMA node of calling thread (again).
+   * Should be called by threads after they have been pinned to a CPU on another NUMA node.
+   * Creates pools for this node if they do not exist yet.
+   *
+   * \return Instance for calling thread's NUMA node
+   */
+  static tGlobalBufferPools& UpdateCurrentNumaNode();
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -91,11 +198,47 @@ private:
 
   tGlobalBufferPools();
 
+  /*!
+   * \param numa_node NUMA node of this instance
+   */
+  tGlobalBufferPools(uint32_t numa_node);
+
   ~tGlobalBufferPools();
 
-  /*! singleton instance */
+  /*!
+   * Determines NUMA node of calling thread
+   *
+   * \return NUMA node of calling thread
+   */
+  static uint32_t DetermineCurrentNumaNode();
+
+  /*!
+   * \param numa_node NUMA node
+   * \return Instance for specified NUMA node (created if it does not exist yet)
+   */
+  static tGlobalBufferPools& GetOrCreateInstance(uint32_t numa_node);
+
+  /*! singleton instance (owns instances of other NUMA nodes) */
   static tGlobalBufferPools* instance;
 
+  /*! Instances for all NUMA nodes (NULL for nodes whose pools have not been created yet) */
+  static std::atomic<tGlobalBufferPools*> instances[cMAX_NUMA_NODES];
+
+  /*! Number of NUMA nodes (0 until determined on first call to DetermineCurrentNumaNode()) */
+  static std::atomic<uint32_t> numa_node_count;
+
+  /*! Instance for current thread's NUMA node */
+  static __thread tGlobalBufferPools* current_thread_instance;
+
+  /*! NUMA node of current thread (-1 if not determined yet) */
+  static __thread int current_thread_numa_node;
+
+  /*! NUMA node of this instance */
+  const uint32_t numa_node;
+
+  /*! Number of accesses from threads on this node to buffers from other nodes */
+  std::atomic<size_t> cross_node_accesses;
+
 };
 
 //----------------------------------------------------------------------
@@ -36,6 +36,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/common/tStartupProfiler.h"
 #include "plugins/data_ports/optimized/cheaply_copied_types.h"
 
 //----------------------------------------------------------------------
@@ -93,6 +94,7 @@ tSingleThreadedCheapCopyPortGeneric::tSingleThreadedCheapCopyPortGeneric(common:
     default_value.reset(creation_info.data_type.CreateInstanceGeneric());
     if (creation_info.DefaultValueSet())
     {
+      common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::VALUE_DESERIALIZATION, this);
       rrlib::serialization::tInputStream stream(creation_info.GetDefaultGeneric());
       default_value->Deserialize(stream);
     }
@@ -103,7 +105,9 @@ tSingleThreadedCheapCopyPortGeneric::tSingleThreadedCheapCopyPortGeneric(common:
 }
 
 tSingleThreadedCheapCopyPortGeneric::~tSingleThreadedCheapCopyPortGeneric()
-{}
+{
+  UnregisterPort(current_value.cheaply_copyable_type_index);
+}
 
 void tSingleThreadedCheapCopyPortGeneric::ApplyDefaultValue()
 {
@@ -163,6 +167,7 @@ void tSingleThreadedCheapCopyPortGeneric::InitialPushTo(tAbstractPort& target, b
 {
   common::tPublishOperation<tSingleThreadedCheapCopyPortGeneric, tPublishingData> data(current_value);
   tSingleThreadedCheapCopyPortGeneric& target_port = static_cast<tSingleThreadedCheapCopyPortGeneric&>(target);
+  standard::tEpochReclamation::tReadGuard epoch_guard;  // listener tables are accessed without lock
   if (reverse)
   {
     common::tPublishOperation<tSingleThreadedCheapCopyPortGeneric, tPublishingData>::Receive<true, tChangeStatus::CHANGED_INITIAL>(data, target_port, *this);
@@ -189,6 +194,24 @@ void tSingleThreadedCheapCopyPortGeneric::Publish(const rrlib::rtti::tGenericObj
   }
 }
 
+void tSingleThreadedCheapCopyPortGeneric::PullValue()
+{
+  if (GetFlag(tFlag::HIJACKED_PORT))
+  {
+    return;
+  }
+
+  // pull value from next-best connected source port
+  for (auto it = IncomingConnectionsBegin(); it != IncomingConnectionsEnd(); ++it)
+  {
+    tSingleThreadedCheapCopyPortGeneric& source = static_cast<tSingleThreadedCheapCopyPortGeneric&>(*it);
+    source.PullValue();
+    tPublishingData publishing_data(source.current_value);
+    Assign<tChangeStatus::CHANGED>(publishing_data);
+    return;
+  }
+}
+
 void tSingleThreadedCheapCopyPortGeneric::SetCurrentValueBuffer(void* address)
 {
   std::unique_ptr<rrlib::rtti::tGenericObject> new_buffer(GetDataType().CreateInstanceGeneric(address, false));
@@ -114,6 +114,8 @@ public:
     }
 
     inline void CheckRecycle() {}
+
+    inline void ReserveLocks(int lock_count) {}
   };
 
 
@@ -148,6 +150,7 @@ public:
    */
   void CopyCurrentValueToGenericObject(rrlib::rtti::tGenericObject& buffer, rrlib::time::tTimestamp& timestamp, tStrategy strategy = tStrategy::DEFAULT)
   {
+    PullValueIfRequired(strategy);
     timestamp = CurrentValueTimestamp();
     buffer.DeepCopyFrom(*current_value.data);
   }
@@ -202,6 +205,21 @@ public:
    */
   void Publish(const rrlib::rtti::tGenericObject& data, rrlib::time::tTimestamp timestamp);
 
+  /*!
+   * Pulls value from connected source port - if this is required by the specified strategy.
+   * Port's current value is set to pulled value (there are no pull request handlers in single-threaded mode).
+   *
+   * \param strategy Strategy to use for get operation
+   */
+  inline void PullValueIfRequired(tStrategy strategy)
+  {
+    if (strategy != tStrategy::NEVER_PULL && (strategy != tStrategy::DEFAULT || (!PushStrategy())))
+    {
+      IncrementCounter(common::tPortCounter::PULL);
+      PullValue();
+    }
+  }
+
   /*!
    * Use specified memory address to store current port value in
    *
@@ -290,6 +308,11 @@ private:
   virtual int GetMaxQueueLengthImplementation() const override;
   virtual void InitialPushTo(tAbstractPort& target, bool reverse) override;
 
+  /*!
+   * Sets port's current value to value of connected source port (pulls value of source port first)
+   */
+  void PullValue();
+
   /*!
    * Notify any port listeners of data change
    *
@@ -298,11 +321,12 @@ private:
   template <tChangeStatus CHANGE_CONSTANT>
   inline void NotifyListeners(tPublishingData& publishing_data)
   {
-    if (GetPortListener())
+    const common::tPortListenerTable* listeners = GetPortListeners();
+    if (listeners)
     {
       tChangeContext change_context(*this, publishing_data.value->timestamp, CHANGE_CONSTANT);
       int lock_counter_unused = 0;
-      GetPortListener()->PortChangedRaw(change_context, lock_counter_unused, const_cast<tCurrentValueBuffer&>(*publishing_data.value));
+      listeners->Dispatch(change_context, lock_counter_unused, const_cast<tCurrentValueBuffer&>(*publishing_data.value));
     }
   }
 
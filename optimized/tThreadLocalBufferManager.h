@@ -80,12 +80,6 @@ class tThreadLocalBufferManager : public tCheaplyCopiedBufferManager
 //----------------------------------------------------------------------
 public:
 
-  /*!
-   * Mask for lowest bits from reuse counter to use in port pointer tag
-   * order to avoid the ABA problem
-   */
-  enum { cTAG_MASK = 0x7 };
-
   ~tThreadLocalBufferManager();
 
   /*!
@@ -141,7 +135,7 @@ public:
   template <typename TDeleterType>
   inline void ProcessLockReleasesFromOtherThreads()
   {
-    int old_value = reference_and_reuse_counter.exchange(0) >> 16;
+    int old_value = tCounter::GetReferenceCounter(reference_and_reuse_counter.Reset());
     assert(old_value < 0);
     ReleaseThreadLocalLocks<TDeleterType>(-old_value);
   }
@@ -154,7 +148,7 @@ public:
   template <typename TThreadLocalBufferPools = tThreadLocalBufferPools> // template to get rid of cyclic dependency while keeping inline functions
   inline void ReleaseLocksFromOtherThread(int locks_to_release)
   {
-    int old_value = reference_and_reuse_counter.fetch_sub(locks_to_release << 16) >> 16;
+    int old_value = tCounter::GetReferenceCounter(reference_and_reuse_counter.ReleaseLocks(locks_to_release));
     if (old_value == 0)
     {
       static_cast<TThreadLocalBufferPools*>(this->GetThreadLocalOrigin())->ReturnBufferFromOtherThread(this);
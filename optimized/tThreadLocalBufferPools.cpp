@@ -142,7 +142,7 @@ tThreadLocalBufferPools::tThreadLocalBufferPools() :
     abort();
   }
   thread_local_instance = this;
-  AddMissingPools();
+  PrewarmPools();
 }
 
 tThreadLocalBufferPools::~tThreadLocalBufferPools()
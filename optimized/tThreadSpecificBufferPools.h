@@ -46,6 +46,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/data_ports/common/tPortBufferPool.h"
+#include "plugins/data_ports/optimized/tBufferPoolSizingPolicy.h"
 #include "plugins/data_ports/optimized/cheaply_copied_types.h"
 #include "plugins/data_ports/optimized/tCheaplyCopiedBufferManager.h"
 #include "plugins/data_ports/optimized/tThreadLocalBufferManager.h"
@@ -64,6 +65,18 @@ namespace optimized
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
 
+/*!
+ * Statistics on a buffer pool
+ */
+struct tBufferPoolStatistics
+{
+  /*! Number of buffers that have been allocated for pool (including buffers currently in use) */
+  size_t allocated_buffers;
+
+  /*! Number of times a buffer was requested from the pool and had to be allocated, because there was no unused buffer */
+  size_t misses;
+};
+
 //----------------------------------------------------------------------
 // Class declaration
 //----------------------------------------------------------------------
@@ -100,10 +113,33 @@ public:
   {
     if (SHARED)
     {
-      AddMissingPools();
+      PrewarmPools();
     }
   }
 
+  /*!
+   * \param cheaply_copied_type_index 'Cheaply copied type index' of pool
+   * \return Statistics on pool for specified type
+   */
+  tBufferPoolStatistics GetPoolStatistics(uint32_t cheaply_copied_type_index) const
+  {
+    const tBufferPool& pool = pools[cheaply_copied_type_index];
+    return tBufferPoolStatistics { pool.GetAllocatedBufferCount(), pool.GetMissCount() };
+  }
+
+  /*!
+   * \return Number of misses in all pools (see tBufferPoolStatistics::misses)
+   */
+  size_t GetTotalMissCount() const
+  {
+    size_t result = 0;
+    for (const tBufferPool & pool : pools)
+    {
+      result += pool.GetMissCount();
+    }
+    return result;
+  }
+
   /*!
    * \param cheaply_copied_type_index 'Cheaply copied type index' of buffer to obtain
    * \return Unused buffer of specified type
@@ -113,26 +149,56 @@ public:
     return pools[cheaply_copied_type_index].GetUnusedBuffer(cheaply_copied_type_index);
   }
 
-//----------------------------------------------------------------------
-// Protected fields and methods
-//----------------------------------------------------------------------
-protected:
-
-  /*! The set of pools (index is index in CheaplyCopiedTypeRegister) */
-  std::array<tBufferPool, cMAX_CHEAPLY_COPYABLE_TYPES> pools;
-
   /*!
-   * Adds/Initialized buffer pools for existing types
+   * Fills pools of all registered types up to the size determined by the current tBufferPoolSizingPolicy
+   * (based on the number of ports, connections and queue capacities of each type).
+   * Should be called after ports have been created and connected - so that publishing does not
+   * need to allocate buffers in real-time threads.
+   * Thread-local pools may only be prewarmed by the thread they belong to.
+   * On NUMA systems, there are global pools for every node: tGlobalBufferPools::Instance().PrewarmPools()
+   * only prewarms the pools of the calling thread's node - tGlobalBufferPools::PrewarmAllNumaNodes()
+   * creates and prewarms the pools of all nodes.
+   *
+   * \return Number of buffers that were allocated
    */
-  void AddMissingPools()
+  size_t PrewarmPools()
   {
+    common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::BUFFER_PREWARMING);
+    // (in single-threaded builds, global pools are not shared - and also use the policy for thread-local pools)
+    const tBufferPoolSizingPolicy& policy = GetBufferPoolSizingPolicy(!SHARED);
+    size_t allocated = 0;
     uint32_t type_count = GetRegisteredTypeCount();
     for (uint32_t i = 0; i < type_count; i++)
     {
-      size_t initial_size = (i == 0) ? 50 : std::min<size_t>(GetPortCount(i), 10); // TODO: add proper heuristics/mechanisms for initial buffer allocation
-      pools[i].AllocateAdditionalBuffers(GetType(i), initial_size);
+      size_t target_size = policy.GetPoolSize(i, GetPortCount(i), GetConnectionCount(i), GetQueueCapacity(i));
+      size_t current_size = pools[i].GetAllocatedBufferCount();
+      if (target_size > current_size)
+      {
+        pools[i].AllocateAdditionalBuffers(GetType(i), target_size - current_size);
+        allocated += target_size - current_size;
+      }
+    }
+    return allocated;
+  }
+
+  /*!
+   * Resets miss counters of all pools to zero
+   */
+  void ResetMissCounts()
+  {
+    for (tBufferPool & pool : pools)
+    {
+      pool.ResetMissCount();
     }
   }
+
+//----------------------------------------------------------------------
+// Protected fields and methods
+//----------------------------------------------------------------------
+protected:
+
+  /*! The set of pools (index is index in CheaplyCopiedTypeRegister) */
+  std::array<tBufferPool, cMAX_CHEAPLY_COPYABLE_TYPES> pools;
 };
 
 //----------------------------------------------------------------------
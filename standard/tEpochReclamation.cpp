@@ -0,0 +1,248 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/standard/tEpochReclamation.cpp
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/data_ports/standard/tEpochReclamation.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include "core/log_messages.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/standard/tThreadLocalBufferCache.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace standard
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+constexpr uint64_t tEpochReclamation::cINACTIVE;
+std::atomic<uint64_t> tEpochReclamation::global_epoch(0);
+std::array<tEpochReclamation::tThreadRecord, tEpochReclamation::cMAX_THREADS> tEpochReclamation::records;
+std::atomic<size_t> tEpochReclamation::records_in_use(0);
+std::atomic<size_t> tEpochReclamation::retired_buffer_count(0);
+std::atomic<size_t> tEpochReclamation::unpinned_readers(0);
+std::vector<tEpochReclamation::tRetiredObject> tEpochReclamation::orphaned_buffers;
+std::atomic<size_t> tEpochReclamation::orphaned_buffer_count(0);
+__thread tEpochReclamation::tThreadRecord* tEpochReclamation::current_record = NULL;
+
+namespace internal
+{
+
+/*! Mutex for buffers of terminated threads */
+static rrlib::thread::tMutex& GetOrphanMutex()
+{
+  static rrlib::thread::tMutex mutex;
+  return mutex;
+}
+
+}
+
+
+struct tEpochReclamation::tRecordReleaser
+{
+  tThreadRecord* record;
+
+  tRecordReleaser() : record(NULL)
+  {}
+
+  ~tRecordReleaser()
+  {
+    if (!record)
+    {
+      return;
+    }
+    assert(record->pin_depth == 0);
+    ReclaimSafeObjects(record->retired);
+    if (record->retired.size())
+    {
+      rrlib::thread::tLock lock(internal::GetOrphanMutex());
+      orphaned_buffers.insert(orphaned_buffers.end(), record->retired.begin(), record->retired.end());
+      orphaned_buffer_count.store(orphaned_buffers.size());
+      record->retired.clear();
+    }
+    record->retirements = 0;
+    current_record = NULL;
+    record->used.store(false, std::memory_order_release);
+  }
+};
+
+tEpochReclamation::tThreadRecord* tEpochReclamation::ClaimRecord()
+{
+  static thread_local tRecordReleaser releaser;
+  for (size_t i = 0; i < cMAX_THREADS; i++)
+  {
+    bool expected = false;
+    if ((!records[i].used.load(std::memory_order_relaxed)) && records[i].used.compare_exchange_strong(expected, true))
+    {
+      size_t in_use = records_in_use.load();
+      while (in_use < i + 1 && (!records_in_use.compare_exchange_weak(in_use, i + 1)))
+      {}
+      current_record = &records[i];
+      releaser.record = current_record;
+      return current_record;
+    }
+  }
+  static bool warned = false;
+  if (!warned)
+  {
+    warned = true;
+    FINROC_LOG_PRINT_STATIC(WARNING, "All ", cMAX_THREADS, " thread records for epoch-based reclamation are occupied. Ports' buffers are locked for reading instead.");
+  }
+  return NULL;
+}
+
+void tEpochReclamation::Reclaim()
+{
+  TryAdvance();
+  if (current_record)
+  {
+    current_record->retirements = 0;
+    ReclaimSafeObjects(current_record->retired);
+  }
+  if (orphaned_buffer_count.load(std::memory_order_relaxed))
+  {
+    rrlib::thread::tLock lock(internal::GetOrphanMutex());
+    ReclaimSafeObjects(orphaned_buffers);
+    orphaned_buffer_count.store(orphaned_buffers.size());
+  }
+}
+
+void tEpochReclamation::ReclaimSafeObjects(std::vector<tRetiredObject>& retired)
+{
+  uint64_t epoch = global_epoch.load();
+  size_t reclaim_count = 0;
+  while (reclaim_count < retired.size() && retired[reclaim_count].epoch + 2 <= epoch)
+  {
+    reclaim_count++;
+  }
+  if (reclaim_count == 0)
+  {
+    return;
+  }
+  for (size_t i = 0; i < reclaim_count; i++)
+  {
+    retired[i].reclaim(retired[i].object);
+  }
+  retired.erase(retired.begin(), retired.begin() + reclaim_count);
+}
+
+void tEpochReclamation::RecycleBuffer(void* buffer)
+{
+  tPortBufferManager* manager = static_cast<tPortBufferManager*>(buffer);
+  manager->SetEpochProtected(false);  // recycler must not retire buffer again
+  tThreadLocalBufferCache::tRecycler recycler;
+  recycler(manager);
+  retired_buffer_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void tEpochReclamation::Retire(tPortBufferManager* buffer)
+{
+  retired_buffer_count.fetch_add(1, std::memory_order_relaxed);
+  RetireEntry(buffer, &RecycleBuffer);
+}
+
+void tEpochReclamation::RetireEntry(void* object, void (*reclaim)(void*))
+{
+  tThreadRecord* record = current_record ? current_record : ClaimRecord();
+  if (!record)
+  {
+    rrlib::thread::tLock lock(internal::GetOrphanMutex());
+    orphaned_buffers.push_back({ global_epoch.load(), object, reclaim });
+    orphaned_buffer_count.store(orphaned_buffers.size());
+    return;
+  }
+  if (record->retired.capacity() == 0)
+  {
+    record->retired.reserve(4 * cRECLAIM_INTERVAL);
+  }
+  record->retired.push_back({ global_epoch.load(), object, reclaim });
+  record->retirements++;
+  if (record->retirements >= cRECLAIM_INTERVAL)
+  {
+    Reclaim();
+  }
+}
+
+void tEpochReclamation::TryAdvance()
+{
+  uint64_t epoch = global_epoch.load();
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (unpinned_readers.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  size_t in_use = records_in_use.load();
+  for (size_t i = 0; i < in_use; i++)
+  {
+    uint64_t record_epoch = records[i].epoch.load(std::memory_order_relaxed);
+    if (record_epoch != cINACTIVE && record_epoch != epoch)
+    {
+      return;
+    }
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  global_epoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
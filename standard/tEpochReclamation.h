@@ -0,0 +1,339 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/standard/tEpochReclamation.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tEpochReclamation
+ *
+ * \b tEpochReclamation
+ *
+ * Epoch-based reclamation of buffers of standard ports with epoch-protected reads
+ * (and of other objects that publishing threads access without locking).
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__standard__tEpochReclamation_h__
+#define __plugins__data_ports__standard__tEpochReclamation_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace standard
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+class tPortBufferManager;
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Epoch-based reclamation of port buffers
+/*!
+ * Readers of ports with epoch-protected reads (see tStandardPort::SetEpochProtectedReads())
+ * pin the current epoch and access the port's current value without modifying its reference counter.
+ * Buffers that were current value of such ports are therefore not recycled immediately when their
+ * last lock is released. Instead, they are retired and recycled after the global epoch has advanced
+ * twice - which is only possible once all threads that were pinned at the time have unpinned.
+ *
+ * Other objects that are replaced while readers might still access them (push plans and listener tables of ports)
+ * are retired via RetireObject() - and deleted in the same way. Publishing operations pin the epoch while they use them.
+ *
+ * Every thread that pins epochs or retires buffers occupies one of cMAX_THREADS thread records
+ * (released when thread terminates). If all records are occupied, readers fall back to locking -
+ * and the global epoch does not advance while such readers exist.
+ * Retired buffers and objects are reclaimed by the thread that retired them (every cRECLAIM_INTERVAL retirements) -
+ * or on calls to Reclaim().
+ */
+class tEpochReclamation : private rrlib::util::tNoncopyable
+{
+  struct tThreadRecord;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Maximum number of threads that can pin epochs or retire buffers simultaneously */
+  enum { cMAX_THREADS = 256 };
+
+  /*! Number of retirements after which a thread attempts to recycle its retired buffers */
+  enum { cRECLAIM_INTERVAL = 8 };
+
+  /*!
+   * Pins current epoch while object exists.
+   * Port buffers obtained from ports with epoch-protected reads - as well as push plans and listener tables
+   * obtained from ports - remain valid during this time (objects may be nested).
+   */
+  class tReadGuard : private rrlib::util::tNoncopyable
+  {
+  public:
+
+    tReadGuard() : record(Pin())
+    {
+      if (!record)
+      {
+        unpinned_readers.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);  // must be visible before any protected object is read
+      }
+    }
+
+    ~tReadGuard()
+    {
+      if (record)
+      {
+        Unpin(*record);
+      }
+      else
+      {
+        unpinned_readers.fetch_sub(1, std::memory_order_release);
+      }
+    }
+
+    /*!
+     * \return Whether epoch was pinned (false if no thread record was available - buffers must be locked then)
+     */
+    bool Pinned() const
+    {
+      return record;
+    }
+
+  private:
+
+    /*! Record of current thread (NULL if epoch was not pinned) */
+    tThreadRecord* record;
+  };
+
+  /*!
+   * \return Number of buffers that have been retired and not yet recycled
+   */
+  static size_t GetRetiredBufferCount()
+  {
+    return retired_buffer_count.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * Attempts to advance global epoch and recycles all retired buffers that can safely be recycled
+   * (buffers retired by current thread and buffers of terminated threads)
+   */
+  static void Reclaim();
+
+  /*!
+   * Retires buffer whose last lock was released.
+   * Buffer is recycled when no reader can access it anymore.
+   *
+   * \param buffer Buffer to retire
+   */
+  static void Retire(tPortBufferManager* buffer);
+
+  /*!
+   * Retires object that was replaced while readers might still access it.
+   * Object is deleted when no reader can access it anymore.
+   *
+   * \param object Object to retire
+   */
+  template <typename T>
+  static void RetireObject(T* object)
+  {
+    RetireEntry(object, &DeleteObject<T>);
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Epoch value of threads that are not pinned */
+  static constexpr uint64_t cINACTIVE = std::numeric_limits<uint64_t>::max();
+
+  /*! Buffer or other object retired in specific epoch */
+  struct tRetiredObject
+  {
+    /*! Epoch in which object was retired */
+    uint64_t epoch;
+
+    /*! Retired object */
+    void* object;
+
+    /*! Function that recycles or deletes object */
+    void (*reclaim)(void*);
+  };
+
+  /*! Information on thread that pins epochs or retires buffers */
+  struct tThreadRecord
+  {
+    /*! Epoch that thread has pinned (cINACTIVE if none) */
+    std::atomic<uint64_t> epoch;
+
+    /*! Is record occupied by a thread? */
+    std::atomic<bool> used;
+
+    /*! Number of nested tReadGuard objects */
+    uint32_t pin_depth;
+
+    /*! Number of retirements since last attempt to recycle buffers */
+    uint32_t retirements;
+
+    /*! Buffers and objects retired by thread (ordered by epoch) */
+    std::vector<tRetiredObject> retired;
+
+    tThreadRecord() : epoch(cINACTIVE), used(false), pin_depth(0), retirements(0), retired()
+    {}
+  };
+
+  /*! Releases record of current thread when thread terminates */
+  struct tRecordReleaser;
+
+  /*! Global epoch */
+  static std::atomic<uint64_t> global_epoch;
+
+  /*! Thread records */
+  static std::array<tThreadRecord, cMAX_THREADS> records;
+
+  /*! Number of thread records that have been occupied at least once (records beyond this index need not be checked) */
+  static std::atomic<size_t> records_in_use;
+
+  /*! Number of buffers that have been retired and not yet recycled */
+  static std::atomic<size_t> retired_buffer_count;
+
+  /*! Number of readers that could not pin epoch (global epoch must not advance while there are any) */
+  static std::atomic<size_t> unpinned_readers;
+
+  /*! Buffers and objects retired by threads that have terminated or had no record (protected by orphan mutex) */
+  static std::vector<tRetiredObject> orphaned_buffers;
+
+  /*! Number of entries in orphaned_buffers (allows checking without acquiring mutex) */
+  static std::atomic<size_t> orphaned_buffer_count;
+
+  /*! Record of current thread (NULL if thread has none yet) */
+  static __thread tThreadRecord* current_record;
+
+
+  /*!
+   * \return Record for current thread - NULL if all records are occupied
+   */
+  static tThreadRecord* ClaimRecord();
+
+  /*!
+   * Pins current epoch
+   *
+   * \return Record of current thread (NULL if epoch could not be pinned)
+   */
+  static inline tThreadRecord* Pin()
+  {
+    tThreadRecord* record = current_record;
+    if (!record)
+    {
+      record = ClaimRecord();
+      if (!record)
+      {
+        return NULL;
+      }
+    }
+    if (record->pin_depth++ == 0)
+    {
+      record->epoch.store(global_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);  // epoch must be visible before port's current value is read
+    }
+    return record;
+  }
+
+  /*!
+   * Deletes retired object
+   */
+  template <typename T>
+  static void DeleteObject(void* object)
+  {
+    delete static_cast<T*>(object);
+  }
+
+  /*!
+   * Recycles buffers and deletes objects from the specified list that can safely be reclaimed
+   *
+   * \param retired List of retired buffers and objects (ordered by epoch)
+   */
+  static void ReclaimSafeObjects(std::vector<tRetiredObject>& retired);
+
+  /*!
+   * Recycles retired buffer
+   */
+  static void RecycleBuffer(void* buffer);
+
+  /*!
+   * Retires buffer or object
+   *
+   * \param object Buffer or object to retire
+   * \param reclaim Function that recycles or deletes object
+   */
+  static void RetireEntry(void* object, void (*reclaim)(void*));
+
+  /*!
+   * Advances global epoch if all pinned threads have pinned the current epoch
+   */
+  static void TryAdvance();
+
+  /*!
+   * Unpins epoch
+   *
+   * \param record Record of current thread
+   */
+  static inline void Unpin(tThreadRecord& record)
+  {
+    if (--record.pin_depth == 0)
+    {
+      record.epoch.store(cINACTIVE, std::memory_order_release);
+    }
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
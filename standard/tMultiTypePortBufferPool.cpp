@@ -104,6 +104,7 @@ tMultiTypePortBufferPool::tPointer tMultiTypePortBufferPool::PossiblyCreatePool(
   }
 
   // create new pool
+  common::tAllocationMonitor::ReportAllocation(common::tAllocationSite::BUFFER_POOL, data_type);
   tBufferPool* new_pool = new tBufferPool(data_type, 2);
   pools.emplace_back(tPoolsEntry(data_type, std::unique_ptr<tBufferPool>(new_pool)));
   return new_pool->GetUnusedBuffer(data_type);
@@ -32,10 +32,13 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include "rrlib/rtti/tTypeAnnotation.h"
+#include "rrlib/thread/tLock.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/tBufferReuse.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -67,12 +70,67 @@ namespace standard
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
+namespace internal
+{
+
+/*! Annotation with reuse functions of a type */
+class tReuseAnnotation : public rrlib::rtti::tTypeAnnotation
+{
+public:
+
+  tReuseAnnotation(tPortBufferManager::tReuseFunction prepare, tPortBufferManager::tReuseFunction reset) : prepare(prepare), reset(reset) {}
+
+  /*! Reuse functions */
+  tPortBufferManager::tReuseFunction prepare, reset;
+};
+
+template <typename T>
+void PrepareBuffer(void* buffer)
+{
+  tBufferReuse<T>::Prepare(*static_cast<T*>(buffer));
+}
+
+template <typename T>
+void ResetBuffer(void* buffer)
+{
+  tBufferReuse<T>::Reset(*static_cast<T*>(buffer));
+}
+
+}
+
+/*!
+ * \return Mutex for registering reuse functions
+ */
+static rrlib::thread::tMutex& GetReuseRegisterMutex()
+{
+  static rrlib::thread::tMutex mutex;
+  return mutex;
+}
+
+/*!
+ * \param type Data type
+ * \return Reuse functions of type (NULL if there are none)
+ */
+static internal::tReuseAnnotation* GetReuseAnnotation(const rrlib::rtti::tType& type)
+{
+  internal::tReuseAnnotation* annotation = type.GetAnnotation<internal::tReuseAnnotation>();
+  if ((!annotation) && type.GetRttiName() == typeid(tString).name())
+  {
+    // Strings always reserve a certain buffer size (for RT capabilities with smaller payload)
+    tPortBufferManager::SetReuseFunctions(type, &internal::PrepareBuffer<tString>, &internal::ResetBuffer<tString>);
+    annotation = type.GetAnnotation<internal::tReuseAnnotation>();
+  }
+  return annotation;
+}
 
 tPortBufferManager::tPortBufferManager() :
   unused(true),
   derived_from(NULL),
   compression_status(0),
-  compressed_data()
+  epoch_protected(false),
+  compressed_data(),
+  reset_function(NULL),
+  cache_pool_id(0)
 {}
 
 tPortBufferManager::~tPortBufferManager()
@@ -85,7 +143,31 @@ tPortBufferManager* tPortBufferManager::CreateInstance(const rrlib::rtti::tType&
   static_assert(sizeof(tPortBufferManager) % 8 == 0, "Port Data manager must be aligned to 8 byte boundary");
   char* placement = (char*)operator new(sizeof(tPortBufferManager) + type.GetSize(true));
   type.CreateInstanceGeneric(placement + sizeof(tPortBufferManager));
-  return new(placement) tPortBufferManager();
+  tPortBufferManager* result = new(placement) tPortBufferManager();
+  internal::tReuseAnnotation* annotation = GetReuseAnnotation(type);
+  if (annotation)
+  {
+    if (annotation->prepare)
+    {
+      (*annotation->prepare)(placement + sizeof(tPortBufferManager));
+    }
+    result->reset_function = annotation->reset;
+  }
+  return result;
+}
+
+void tPortBufferManager::SetReuseFunctions(const rrlib::rtti::tType& type, tReuseFunction prepare, tReuseFunction reset)
+{
+  rrlib::thread::tLock lock(GetReuseRegisterMutex());
+  internal::tReuseAnnotation* annotation = type.GetAnnotation<internal::tReuseAnnotation>();
+  if (annotation)
+  {
+    annotation->prepare = prepare;
+    annotation->reset = reset;
+    return;
+  }
+  rrlib::rtti::tType type_copy = type;
+  type_copy.AddAnnotation(new internal::tReuseAnnotation(prepare, reset));
 }
 
 rrlib::rtti::tGenericObject& tPortBufferManager::GetObjectImplementation()
@@ -91,6 +91,9 @@ class tPortBufferManager : public common::tReferenceCountingBufferManager
 //----------------------------------------------------------------------
 public:
 
+  /*! Function that prepares or resets a buffer (argument points to the buffer's data) */
+  typedef void (*tReuseFunction)(void*);
+
   ~tPortBufferManager();
 
   /*!
@@ -139,6 +142,14 @@ public:
    */
   static tPortBufferManager* CreateInstance(const rrlib::rtti::tType& type);
 
+  /*!
+   * \return Id of standard port buffer pool that this buffer belongs to (0 if it is not known - see tThreadLocalBufferCache)
+   */
+  inline uint64_t GetCachePoolId() const
+  {
+    return cache_pool_id;
+  }
+
   /*!
    * \return Managed Buffer as generic object
    */
@@ -147,6 +158,14 @@ public:
     return reinterpret_cast<rrlib::rtti::tGenericObject&>(*(this + 1));
   }
 
+  /*!
+   * \return Is buffer (or was it) current value of a port with epoch-protected reads? (recycling must then be deferred - see tEpochReclamation)
+   */
+  inline bool IsEpochProtected() const
+  {
+    return epoch_protected.load(std::memory_order_relaxed);
+  }
+
   /*!
    * \return Is this (still) a unused buffer?
    */
@@ -155,6 +174,45 @@ public:
     return unused;
   }
 
+  /*!
+   * Resets buffer for reuse - using the reset function registered for its type (see SetReuseFunctions()).
+   * Called whenever a buffer is obtained from a pool for publishing.
+   */
+  inline void ResetForReuse()
+  {
+    if (reset_function)
+    {
+      (*reset_function)(GetObject().GetRawDataPointer());
+    }
+  }
+
+  /*!
+   * Registers functions for preparing and resetting buffers of the specified type.
+   * Only affects buffers that are created after the call.
+   * (typically called for customized tBufferReuse types when the first port of a type is created)
+   *
+   * \param type Data type
+   * \param prepare Function that is called once on every new buffer (NULL for none)
+   * \param reset Function that is called whenever a buffer is obtained from a pool for publishing (NULL for none)
+   */
+  static void SetReuseFunctions(const rrlib::rtti::tType& type, tReuseFunction prepare, tReuseFunction reset);
+
+  /*!
+   * \param pool_id Id of standard port buffer pool that this buffer belongs to
+   */
+  inline void SetCachePoolId(uint64_t pool_id)
+  {
+    cache_pool_id = pool_id;
+  }
+
+  /*!
+   * \param epoch_protected Whether buffer is (or was) current value of a port with epoch-protected reads
+   */
+  inline void SetEpochProtected(bool epoch_protected)
+  {
+    this->epoch_protected.store(epoch_protected, std::memory_order_relaxed);
+  }
+
   /*!
    * \param unused Whether to mark this buffer as still unused
    */
@@ -180,9 +238,18 @@ private:
   /*! Compression status */
   std::atomic<uint8_t> compression_status;
 
+  /*! Is buffer (or was it) current value of a port with epoch-protected reads? */
+  std::atomic<bool> epoch_protected;
+
   /*! Info on compressed data (compressed data, compression format, key frame?) */
   std::unique_ptr<std::tuple<rrlib::serialization::tMemoryBuffer, const char*, bool>> compressed_data;
 
+  /*! Function that resets buffer for reuse (NULL if buffer type requires no reset) */
+  tReuseFunction reset_function;
+
+  /*! Id of standard port buffer pool that this buffer belongs to (0 if not known) */
+  uint64_t cache_pool_id;
+
   tPortBufferManager();
 
   virtual rrlib::rtti::tGenericObject& GetObjectImplementation() override;
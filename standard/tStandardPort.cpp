@@ -40,6 +40,7 @@
 //----------------------------------------------------------------------
 #include "plugins/data_ports/type_traits.h"
 #include "plugins/data_ports/common/tPullOperation.h"
+#include "plugins/data_ports/common/tStartupProfiler.h"
 #include "plugins/data_ports/standard/tMultiTypePortBufferPool.h"
 #include "plugins/data_ports/optimized/tCheapCopyPort.h"
 #include "plugins/data_ports/optimized/tSingleThreadedCheapCopyPortGeneric.h"
@@ -104,13 +105,18 @@ tDataPortFactory default_data_port_factory;
 } // namespace internal
 
 
+/*! Id for next buffer pool that is created (see tThreadLocalBufferCache) */
+static std::atomic<uint64_t> next_buffer_pool_id(1);
+
 tStandardPort::tStandardPort(common::tAbstractDataPortCreationInfo creation_info) :
   common::tAbstractDataPort(creation_info),
   buffer_pool(this->GetDataType(), IsOutputPort() ? 2 : 0),
+  buffer_pool_id(next_buffer_pool_id.fetch_add(1)),
   multi_type_buffer_pool(GetFlag(tFlag::MULTI_TYPE_BUFFER_POOL) ? new tMultiTypePortBufferPool(buffer_pool, GetDataType()) : NULL),
   default_value(CreateDefaultValue(creation_info, buffer_pool)),
   current_value(0),
   standard_assign(!GetFlag(tFlag::NON_STANDARD_ASSIGN) && (!GetFlag(tFlag::HAS_QUEUE))),
+  epoch_protected_reads(false),
   compression_active_status(-2),
   data_compressor_mutex("tStandardPort data compressor"),
   input_queue(),
@@ -137,7 +143,7 @@ tStandardPort::tStandardPort(common::tAbstractDataPortCreationInfo creation_info
   // Initialize queue
   if (GetFlag(tFlag::HAS_QUEUE))
   {
-    input_queue.reset(new common::tPortQueue<tLockingManagerPointer>(!GetFlag(tFlag::HAS_DEQUEUE_ALL_QUEUE)));
+    input_queue.reset(new common::tPortQueue<tLockingManagerPointer>(!GetFlag(tFlag::HAS_DEQUEUE_ALL_QUEUE), *this, creation_info.queue_ring_buffer));
     if (creation_info.max_queue_size > 0)
     {
       input_queue->SetMaxQueueLength(creation_info.max_queue_size);
@@ -153,6 +159,10 @@ tStandardPort::~tStandardPort()
   tTaggedBufferPointer cur_pointer = current_value.load();
   tPortBufferUnlocker unlocker;
   unlocker(cur_pointer.GetPointer()); // thread safe, since nobody should publish to port anymore
+  if (tThreadLocalBufferCache::Get())
+  {
+    tThreadLocalBufferCache::Get()->Discard(buffer_pool_id);
+  }
 
   delete multi_type_buffer_pool;
 }
@@ -223,6 +233,7 @@ tPortBufferManager* tStandardPort::CreateDefaultValue(const common::tAbstractDat
     pdm->InitReferenceCounter(1);
     if (creation_info.DefaultValueSet())
     {
+      common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::VALUE_DESERIALIZATION);
       rrlib::serialization::tInputStream input(creation_info.GetDefaultGeneric());
       pdm->GetObject().Deserialize(input);
     }
@@ -261,8 +272,10 @@ int tStandardPort::GetMaxQueueLengthImplementation() const
 tStandardPort::tUnusedManagerPointer tStandardPort::GetUnusedBufferRaw(const rrlib::rtti::tType& dt)
 {
   assert(multi_type_buffer_pool);
+  common::tAllocationMonitor::tPortScope allocation_scope(*this);
   tUnusedManagerPointer buffer = multi_type_buffer_pool->GetUnusedBuffer(dt);
   buffer->SetUnused(true);
+  buffer->ResetForReuse();
   return buffer;
 }
 
@@ -271,8 +284,9 @@ void tStandardPort::InitialPushTo(tAbstractPort& target, bool reverse)
   tLockingManagerPointer manager = GetCurrentValueRaw(tStrategy::NEVER_PULL);
   assert(IsReady());
 
-  common::tPublishOperation<tStandardPort, tPublishingData> data(manager, 1000);
+  common::tPublishOperation<tStandardPort, tPublishingData> data(manager, cDEFAULT_PUBLISH_LOCKS);
   tStandardPort& target_port = static_cast<tStandardPort&>(target);
+  tEpochReclamation::tReadGuard epoch_guard;  // listener tables are accessed without lock
   if (reverse)
   {
     common::tPublishOperation<tStandardPort, tPublishingData>::Receive<true, tChangeStatus::CHANGED_INITIAL>(data, target_port, *this);
@@ -297,7 +311,28 @@ void tStandardPort::NonStandardAssign(tPublishingData& publishing_data, tChangeS
 
     // enqueue
     publishing_data.AddLock();
-    input_queue->Enqueue(tLockingManagerPointer(publishing_data.published_buffer));
+    if (input_queue->Enqueue(tLockingManagerPointer(publishing_data.published_buffer)))
+    {
+      IncrementCounter(common::tPortCounter::QUEUE_OVERFLOW);
+    }
+  }
+}
+
+void tStandardPort::OnConnect(tAbstractPort& partner, bool partner_is_destination)
+{
+  common::tAbstractDataPort::OnConnect(partner, partner_is_destination);
+  if ((!partner_is_destination) && input_queue)
+  {
+    input_queue->UpdateSourceCount(1);
+  }
+}
+
+void tStandardPort::OnDisconnect(tAbstractPort& partner, bool partner_is_destination)
+{
+  common::tAbstractDataPort::OnDisconnect(partner, partner_is_destination);
+  if ((!partner_is_destination) && input_queue)
+  {
+    input_queue->UpdateSourceCount(-1);
   }
 }
 
@@ -312,7 +347,7 @@ void tStandardPort::PrintStructure(int indent, std::stringstream& output) const
 
 tStandardPort::tLockingManagerPointer tStandardPort::PullValueRaw(bool ignore_pull_request_handler_on_this_port)
 {
-  common::tPullOperation<tStandardPort, tPublishingData, tPortBufferManager> pull_operation(200);
+  common::tPullOperation<tStandardPort, tPublishingData, tPortBufferManager> pull_operation(cPULL_LOCKS);
   pull_operation.Execute(*this);
   return tLockingManagerPointer(pull_operation.published_buffer);
 }
@@ -325,6 +360,21 @@ tStandardPort::tLockingManagerPointer tStandardPort::PullValueRaw(bool ignore_pu
 //  queue->SetMaxLength(length);
 //}
 
+void tStandardPort::SetEpochProtectedReads(bool epoch_protected_reads)
+{
+  if (IsReady())
+  {
+    FINROC_LOG_PRINT(ERROR, "Epoch-protected reads may only be enabled or disabled before port is initialized. Ignoring.");
+    return;
+  }
+  this->epoch_protected_reads = epoch_protected_reads;
+  if (epoch_protected_reads)
+  {
+    tTaggedBufferPointer current_buffer = current_value.load();
+    current_buffer->SetEpochProtected(true);
+  }
+}
+
 void tStandardPort::SetPullRequestHandler(tPullRequestHandlerRaw* pull_request_handler_)
 {
   if (pull_request_handler_ != NULL)
@@ -43,6 +43,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -52,7 +53,9 @@
 #include "plugins/data_ports/common/tPortBufferPool.h"
 #include "plugins/data_ports/common/tPortQueue.h"
 #include "plugins/data_ports/common/tPublishOperation.h"
+#include "plugins/data_ports/standard/tEpochReclamation.h"
 #include "plugins/data_ports/standard/tPortBufferManager.h"
+#include "plugins/data_ports/standard/tThreadLocalBufferCache.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -100,13 +103,13 @@ public:
 
 private:
 
-  typedef rrlib::util::tTaggedPointer<tPortBufferManager, true, 3> tTaggedBufferPointer;
+  typedef rrlib::util::tTaggedPointer<tPortBufferManager, true, tPortBufferManager::cTAG_BITS> tTaggedBufferPointer;
 
   struct tPortBufferUnlocker
   {
     void operator()(tPortBufferManager* p) const
     {
-      p->ReleaseLocks<typename tBufferPool::tPointer::deleter_type, tPortBufferManager>(1);
+      p->ReleaseLocks<tThreadLocalBufferCache::tRecycler, tPortBufferManager>(1);
     }
   };
 
@@ -161,6 +164,32 @@ public:
 
   virtual ~tStandardPort();
 
+  /*!
+   * Calls function with port's current value.
+   * If port has epoch-protected reads (and current value is requested), the buffer is accessed
+   * without modifying its reference counter. Otherwise, it is locked during the call.
+   * In both cases, the buffer must not be modified - and not be accessed after the function returns.
+   *
+   * \param function Function to call (with tPortBufferManager& as argument)
+   * \param strategy Strategy to use for get operation
+   */
+  template <typename TFunction>
+  inline void AccessCurrentValue(TFunction && function, tStrategy strategy = tStrategy::DEFAULT)
+  {
+    if (epoch_protected_reads && ((strategy == tStrategy::DEFAULT && PushStrategy()) || strategy == tStrategy::NEVER_PULL))
+    {
+      tEpochReclamation::tReadGuard guard;
+      if (guard.Pinned())
+      {
+        tTaggedBufferPointer current_buffer = current_value.load();
+        function(*current_buffer.GetPointer());
+        return;
+      }
+    }
+    tLockingManagerPointer pointer = GetCurrentValueRaw(strategy);
+    function(*pointer);
+  }
+
   /*!
    * Set current value to default value
    */
@@ -242,11 +271,22 @@ public:
   /*!
    * \return Unused buffer from send buffers for writing.
    * (Using this method, typically no new buffers/objects need to be allocated)
+   * Buffers of types with reset function (see tPortBufferManager::SetReuseFunctions()) are reset
+   * - e.g. cleared while keeping their capacity.
+   * If the calling thread has a tThreadLocalBufferCache, buffers are obtained from it.
    */
   inline tUnusedManagerPointer GetUnusedBufferRaw()
   {
-    tUnusedManagerPointer buffer = multi_type_buffer_pool ? GetUnusedBufferRaw(GetDataType()) : buffer_pool.GetUnusedBuffer(GetDataType());
+    common::tAllocationMonitor::tPortScope allocation_scope(*this);
+    if (multi_type_buffer_pool)
+    {
+      return GetUnusedBufferRaw(GetDataType());
+    }
+    tThreadLocalBufferCache* cache = tThreadLocalBufferCache::Get();
+    tUnusedManagerPointer buffer = cache ? cache->GetUnusedBuffer(buffer_pool, buffer_pool_id, GetDataType()) : buffer_pool.GetUnusedBuffer(GetDataType());
+    buffer->SetCachePoolId(buffer_pool_id);
     buffer->SetUnused(true);
+    buffer->ResetForReuse();
     return buffer;
   }
 
@@ -268,6 +308,54 @@ public:
     PublishImplementation<false, tChangeStatus::CHANGED, false, false>(data);
   }
 
+  /*!
+   * Allocates buffers for this port's buffer pool up front - so that publishing
+   * does not need to allocate memory later (see common::tAllocationMonitor)
+   *
+   * \param buffer_count Number of buffers the pool should contain (including buffers currently in use)
+   */
+  void ProvisionBuffers(size_t buffer_count)
+  {
+    common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::BUFFER_PREWARMING, this);
+    size_t allocated = buffer_pool.GetAllocatedBufferCount();
+    if (buffer_count > allocated)
+    {
+      buffer_pool.AllocateAdditionalBuffers(GetDataType(), buffer_count - allocated);
+    }
+  }
+
+  /*!
+   * Releases several locks on a buffer at once (with a single atomic operation)
+   *
+   * \param buffer Buffer to release locks of
+   * \param lock_count Number of locks to release
+   */
+  static void ReleaseLocks(tPortBufferManager* buffer, int lock_count)
+  {
+    buffer->ReleaseLocks<tThreadLocalBufferCache::tRecycler, tPortBufferManager>(lock_count);
+  }
+
+  /*!
+   * \return Does port have epoch-protected reads? (see SetEpochProtectedReads())
+   */
+  bool GetEpochProtectedReads() const
+  {
+    return epoch_protected_reads;
+  }
+
+  /*!
+   * Enables or disables epoch-protected reads (see tEpochReclamation).
+   * With epoch-protected reads, AccessCurrentValue() (e.g. used by Get()) does not modify
+   * reference counters - so that readers on different cores do not contend on them.
+   * Buffers that were current value of this port are recycled with some delay then.
+   * Suitable for read-mostly ports with many reader threads.
+   *
+   * May only be called before port is initialized.
+   *
+   * \param epoch_protected_reads Whether to enable epoch-protected reads
+   */
+  void SetEpochProtectedReads(bool epoch_protected_reads);
+
   /*!
    * \param pull_request_handler Object that handles pull requests - null if there is none (typical case)
    */
@@ -328,7 +416,7 @@ protected:
     tPublishingData(tLockingManagerPointer& published, int add_locks) :
       added_locks(add_locks),
       used_locks(0),
-      pointer_tag(published->AddLocks(added_locks - 1)), // 1 was already added by/for "tLockingManagerPointer& published"
+      pointer_tag(added_locks > 1 ? published->AddLocks(added_locks - 1) : published->GetPointerTag()), // 1 was already added by/for "tLockingManagerPointer& published"
       published_buffer(published.get()),
       published_buffer_tagged_pointer(published.release(), pointer_tag)
     {
@@ -349,16 +437,16 @@ protected:
       if (published_buffer)
       {
         assert((used_locks <= added_locks) && "Too many locks in this publishing operation");
-        //if (used_locks < added_locks) // as we usually add ~1000 locks, this check reduces performance
-        //{
-        published_buffer->ReleaseLocks<typename tUnusedManagerPointer::deleter_type, tPortBufferManager>(added_locks - used_locks);
-        //}
+        if (used_locks < added_locks) // with push plans, lock count is often exact
+        {
+          published_buffer->ReleaseLocks<tThreadLocalBufferCache::tRecycler, tPortBufferManager>(added_locks - used_locks);
+        }
       }
     }
 
     /*!
      * Registers another lock on buffer.
-     * (Will increase lock_estimate and reference counter if necessary. (currently not))
+     * (Reference counter is increased in ReserveLocks() if necessary)
      */
     void AddLock()
     {
@@ -383,6 +471,23 @@ protected:
     {
       return used_locks;
     }
+
+    /*!
+     * Makes sure that enough locks were added to the reference counter for the specified number of further locks.
+     * If not, more locks are added - so that this is rarely necessary again in the current publishing operation.
+     * The publishing operation always keeps one lock - so that buffer cannot be recycled before it has completed.
+     *
+     * \param lock_count Maximum number of locks that are about to be used
+     */
+    inline void ReserveLocks(int lock_count)
+    {
+      if (used_locks + lock_count >= added_locks)
+      {
+        int additional_locks = std::max(lock_count, added_locks);
+        published_buffer->AddLocks(additional_locks, pointer_tag);
+        added_locks += additional_locks;
+      }
+    }
   };
 
   /*!
@@ -411,6 +516,9 @@ private:
   /*! Pool with reusable buffers that are published from this port - by any thread */
   tBufferPool buffer_pool;
 
+  /*! Unique id of buffer pool (see tThreadLocalBufferCache) */
+  const uint64_t buffer_pool_id;
+
   /*! Pool with different types of reusable buffers that are published from this port - by any thread */
   tMultiTypePortBufferPool* multi_type_buffer_pool;
 
@@ -433,6 +541,9 @@ private:
    */
   const bool standard_assign;
 
+  /*! Does port have epoch-protected reads? (see SetEpochProtectedReads()) */
+  bool epoch_protected_reads;
+
   friend class data_compression::tPlugin;
 
   /*! accessed by finroc_plugins_data_compression only: Is compression enabled for this port? [31 bytes rule revision when this was checked, 1 byte enabled?] */
@@ -451,6 +562,9 @@ private:
    */
   //public PortBase std11CaseReceiver; // should not need to be volatile
 
+  /*! Number of locks pull operations add to reference counter of pulled buffer (there is no push plan to derive this from) */
+  enum { cPULL_LOCKS = 200 };
+
   /*! Object that handles pull requests - null if there is none (typical case) */
   tPullRequestHandlerRaw* pull_request_handler;
 
@@ -469,8 +583,12 @@ private:
     assert(publishing_data.published_buffer->GetObject().GetType() == GetDataType());
 
     publishing_data.AddLock();
+    if (epoch_protected_reads)
+    {
+      publishing_data.published_buffer->SetEpochProtected(true);  // readers might access buffer without lock
+    }
     tTaggedBufferPointer old = current_value.exchange(publishing_data.published_buffer_tagged_pointer);
-    old->ReleaseLocks<typename tUnusedManagerPointer::deleter_type, tPortBufferManager>(1, old.GetStamp());
+    old->ReleaseLocks<tThreadLocalBufferCache::tRecycler, tPortBufferManager>(1, old.GetStamp());
     if (!standard_assign)
     {
       NonStandardAssign(publishing_data, CHANGE_CONSTANT);
@@ -493,6 +611,10 @@ private:
   // quite similar to publish
   virtual void InitialPushTo(tAbstractPort& target, bool reverse) override;
 
+  virtual void OnConnect(tAbstractPort& partner, bool partner_is_destination) override;
+
+  virtual void OnDisconnect(tAbstractPort& partner, bool partner_is_destination) override;
+
   /*!
    * \param publishing_data Info on current publish/pull operation
    */
@@ -527,10 +649,11 @@ private:
   template <tChangeStatus CHANGE_CONSTANT>
   inline void NotifyListeners(tPublishingData& publishing_data)
   {
-    if (GetPortListener())
+    const common::tPortListenerTable* listeners = GetPortListeners();
+    if (listeners)
     {
       tChangeContext change_context(*this, publishing_data.published_buffer->GetTimestamp(), CHANGE_CONSTANT);
-      GetPortListener()->PortChangedRaw(change_context, publishing_data.ReferenceCounter(), *publishing_data.published_buffer);
+      listeners->Dispatch(change_context, publishing_data.ReferenceCounter(), *publishing_data.published_buffer);
     }
   }
 
@@ -590,8 +713,11 @@ private:
       return;
     }
 
-    common::tPublishOperation<tStandardPort, tPublishingData> publish_operation(data, 1000);
-    publish_operation.Execute<REVERSE, CHANGE_CONSTANT, BROWSER_PUBLISH, NOTIFY_LISTENER_ON_THIS_PORT>(*this);
+    // with frozen topology, the number of locks required is known in advance
+    tEpochReclamation::tReadGuard epoch_guard;
+    const tPushPlan* push_plan = (REVERSE || BROWSER_PUBLISH || CHANGE_CONSTANT != tChangeStatus::CHANGED) ? NULL : GetPushPlan();
+    common::tPublishOperation<tStandardPort, tPublishingData> publish_operation(data, GetPublishLockCount(push_plan));
+    publish_operation.Execute<REVERSE, CHANGE_CONSTANT, BROWSER_PUBLISH, NOTIFY_LISTENER_ON_THIS_PORT>(*this, push_plan);
   }
 
   /*!
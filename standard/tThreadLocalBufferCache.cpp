@@ -0,0 +1,188 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/standard/tThreadLocalBufferCache.cpp
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/data_ports/standard/tThreadLocalBufferCache.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace standard
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+__thread tThreadLocalBufferCache* tThreadLocalBufferCache::current_cache = NULL;
+
+tThreadLocalBufferCache::tThreadLocalBufferCache(size_t batch_size, size_t capacity) :
+  batch_size(std::max<size_t>(1, batch_size)),
+  capacity(std::max(capacity, 2 * this->batch_size)),
+  entries(),
+  next_eviction(0)
+{
+  assert(current_cache == NULL && "Only one buffer cache per thread allowed");
+  for (tEntry & entry : entries)
+  {
+    entry.buffers.reserve(this->capacity);
+  }
+  current_cache = this;
+}
+
+tThreadLocalBufferCache::~tThreadLocalBufferCache()
+{
+  assert(current_cache == this);
+  current_cache = NULL;
+  for (tEntry & entry : entries)
+  {
+    entry.buffers.clear();  // returns buffers to their pools
+  }
+}
+
+void tThreadLocalBufferCache::Discard(uint64_t pool_id)
+{
+  for (tEntry & entry : entries)
+  {
+    if (entry.pool_id == pool_id)
+    {
+      entry.pool_id = 0;
+      entry.buffers.clear();
+      return;
+    }
+  }
+}
+
+tThreadLocalBufferCache::tPointer tThreadLocalBufferCache::GetUnusedBuffer(tBufferPool& pool, uint64_t pool_id, const rrlib::rtti::tType& data_type)
+{
+  tEntry* entry = NULL;
+  tEntry* free_entry = NULL;
+  for (tEntry & candidate : entries)
+  {
+    if (candidate.pool_id == pool_id)
+    {
+      entry = &candidate;
+      break;
+    }
+    if (candidate.pool_id == 0 && (!free_entry))
+    {
+      free_entry = &candidate;
+    }
+  }
+  if (!entry)
+  {
+    if (!free_entry)
+    {
+      free_entry = &entries[next_eviction];
+      next_eviction = (next_eviction + 1) % cMAX_POOLS;
+      free_entry->buffers.clear();
+    }
+    entry = free_entry;
+    entry->pool_id = pool_id;
+  }
+
+  if (entry->buffers.empty())
+  {
+    // Refill with batch of buffers from pool
+    for (size_t i = 0; i < batch_size; i++)
+    {
+      tPointer buffer = pool.GetUnusedBuffer(data_type, false);
+      if (!buffer)
+      {
+        break;
+      }
+      entry->buffers.push_back(std::move(buffer));
+    }
+    if (entry->buffers.empty())
+    {
+      tPointer buffer = pool.GetUnusedBuffer(data_type);
+      buffer->SetCachePoolId(pool_id);
+      return buffer;
+    }
+  }
+
+  tPointer buffer = std::move(entry->buffers.back());
+  entry->buffers.pop_back();
+  buffer->SetCachePoolId(pool_id);
+  return buffer;
+}
+
+bool tThreadLocalBufferCache::Return(tPortBufferManager* buffer)
+{
+  for (tEntry & entry : entries)
+  {
+    if (entry.pool_id == buffer->GetCachePoolId())
+    {
+      if (entry.buffers.size() >= capacity)
+      {
+        // Return batch of buffers to pool
+        entry.buffers.resize(capacity - batch_size);
+      }
+      entry.buffers.emplace_back(buffer);
+      return true;
+    }
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,212 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/standard/tThreadLocalBufferCache.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tThreadLocalBufferCache
+ *
+ * \b tThreadLocalBufferCache
+ *
+ * Thread-local cache in front of the buffer pools of standard ports.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__standard__tThreadLocalBufferCache_h__
+#define __plugins__data_ports__standard__tThreadLocalBufferCache_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <array>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/common/tPortBufferPool.h"
+#include "plugins/data_ports/standard/tPortBufferManager.h"
+#include "plugins/data_ports/standard/tEpochReclamation.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+namespace standard
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Thread-local buffer cache for standard ports
+/*!
+ * Buffer pools of standard ports can be used by any thread concurrently.
+ * Therefore, every buffer that is obtained from or returned to them involves
+ * atomic operations on the pool's shared queue.
+ *
+ * Threads that publish buffers of standard ports at a high rate can create an instance of this
+ * class (opt-in - similar to tThreadLocalBufferManagement for 'cheaply copied' types).
+ * While the object exists, the thread keeps a small stock of unused buffers for each
+ * port pool it uses (front-end cache):
+ * - If the stock is empty, it is refilled with a batch of buffers from the pool.
+ * - Buffers whose last lock is released by this thread are put back into the stock.
+ * - If the stock is full, a batch of buffers is returned to the pool.
+ *
+ * Only buffers from ports' own buffer pools are cached (not from multi-type buffer pools).
+ * The stock of a pool is kept until it is evicted by another pool, the port is deleted
+ * by this thread - or this object is deleted.
+ *
+ * Must be created and deleted by the same thread - and only one instance may exist per thread.
+ */
+class tThreadLocalBufferCache : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Buffer pool type of standard ports */
+  typedef common::tPortBufferPool<tPortBufferManager, rrlib::concurrent_containers::tConcurrency::FULL> tBufferPool;
+
+  /*! Pointer to unused buffer */
+  typedef typename tBufferPool::tPointer tPointer;
+
+  /*! Maximum number of pools that buffers are cached for simultaneously */
+  enum { cMAX_POOLS = 8 };
+
+  /*!
+   * Recycles buffers whose last lock was released.
+   * Puts them into the current thread's cache - or returns them to their pool.
+   * Buffers that were current value of ports with epoch-protected reads are retired instead (see tEpochReclamation).
+   */
+  struct tRecycler
+  {
+    void operator()(tPortBufferManager* p) const
+    {
+      if (p->IsEpochProtected())
+      {
+        tEpochReclamation::Retire(p);
+        return;
+      }
+      tThreadLocalBufferCache* cache = current_cache;
+      if (!(cache && p->GetCachePoolId() && cache->Return(p)))
+      {
+        typename tPointer::deleter_type deleter;
+        deleter(p);
+      }
+    }
+  };
+
+  /*!
+   * \param batch_size Number of buffers that are obtained from - or returned to - a pool at once
+   * \param capacity Maximum number of buffers cached per pool (should be at least twice the batch size)
+   */
+  tThreadLocalBufferCache(size_t batch_size = 4, size_t capacity = 16);
+
+  ~tThreadLocalBufferCache();
+
+  /*!
+   * Returns all cached buffers of the specified pool to it
+   * (called when the port of the pool is deleted)
+   *
+   * \param pool_id Id of pool
+   */
+  void Discard(uint64_t pool_id);
+
+  /*!
+   * \return Cache of current thread (NULL if thread has no cache)
+   */
+  static tThreadLocalBufferCache* Get()
+  {
+    return current_cache;
+  }
+
+  /*!
+   * Obtains unused buffer from cache - refilling cache from pool if necessary
+   *
+   * \param pool Pool to obtain buffer from
+   * \param pool_id Unique id of pool (ids are never reused - unlike pool addresses)
+   * \param data_type Data type of buffers in pool
+   * \return Unused buffer
+   */
+  tPointer GetUnusedBuffer(tBufferPool& pool, uint64_t pool_id, const rrlib::rtti::tType& data_type);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Cached buffers of one pool */
+  struct tEntry
+  {
+    /*! Id of pool (0 if entry is not used) */
+    uint64_t pool_id;
+
+    /*! Cached unused buffers */
+    std::vector<tPointer> buffers;
+
+    tEntry() : pool_id(0), buffers() {}
+  };
+
+  /*! Number of buffers that are obtained from - or returned to - a pool at once */
+  const size_t batch_size;
+
+  /*! Maximum number of buffers cached per pool */
+  const size_t capacity;
+
+  /*! Cached buffers */
+  std::array<tEntry, cMAX_POOLS> entries;
+
+  /*! Index of entry to evict next if all entries are used */
+  size_t next_eviction;
+
+  /*! Cache of current thread */
+  static __thread tThreadLocalBufferCache* current_cache;
+
+  /*!
+   * Puts buffer into cache
+   *
+   * \param buffer Buffer whose last lock was released
+   * \return True if buffer was put into cache (false if there is no entry for buffer's pool)
+   */
+  bool Return(tPortBufferManager* buffer);
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
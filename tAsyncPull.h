@@ -0,0 +1,145 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tAsyncPull.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tAsyncPull
+ *
+ * \b tAsyncPull
+ *
+ * Handle to asynchronous pull operation.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__tAsyncPull_h__
+#define __plugins__data_ports__tAsyncPull_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <utility>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/definitions.h"
+#include "plugins/data_ports/api/tAsyncPullExecutor.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Asynchronous pull operation
+/*!
+ * Handle to pull operation that is executed by worker threads (see tPort::GetAsync() and tGenericPort::GetPointerAsync()).
+ * This way, callers can overlap pull I/O (in pull request handlers) with computation.
+ * If the pull operation has not completed before the caller's deadline, the port's last known value can be used instead.
+ *
+ * \tparam TPort Port wrapper class (tPort<T> or tGenericPort)
+ */
+template <typename TPort>
+class tAsyncPull
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Type of pointer to port's value */
+  typedef decltype(std::declval<TPort&>().GetPointer(tStrategy::NEVER_PULL)) tPointer;
+
+  /*!
+   * Starts pull operation (or joins pending pull operation on this port)
+   *
+   * \param port Port to pull value of
+   */
+  tAsyncPull(const TPort& port) :
+    port(port),
+    completion(api::tAsyncPullExecutor::GetInstance().Pull(*port.GetWrapped()))
+  {}
+
+  /*!
+   * Waits for pull operation to complete (at most until timeout) - and returns port's value
+   *
+   * \param timeout Maximum time to wait
+   * \return Pulled value - or port's last known value if pull operation did not complete within timeout
+   */
+  tPointer GetPointer(const rrlib::time::tDuration& timeout = cPULL_TIMEOUT)
+  {
+    Wait(timeout);
+    return port.GetPointer(tStrategy::NEVER_PULL);
+  }
+
+  /*!
+   * \return Has pull operation completed?
+   */
+  bool Ready() const
+  {
+    return completion.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  }
+
+  /*!
+   * Waits for pull operation to complete
+   *
+   * \param timeout Maximum time to wait
+   * \return Whether pull operation has completed
+   */
+  bool Wait(const rrlib::time::tDuration& timeout) const
+  {
+    return completion.wait_for(timeout) == std::future_status::ready;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Port to pull value of */
+  TPort port;
+
+  /*! Becomes ready when pull operation has completed */
+  std::shared_future<void> completion;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
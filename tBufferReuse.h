@@ -0,0 +1,133 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tBufferReuse.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tBufferReuse
+ *
+ * \b tBufferReuse
+ *
+ * Customization point for preparing and reusing buffers of standard ports.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__tBufferReuse_h__
+#define __plugins__data_ports__tBufferReuse_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Buffer reuse customization
+/*!
+ * Buffers of standard ports are taken from buffer pools and are reused
+ * once they are no longer referenced.
+ * This struct can be specialized for types whose buffers should be treated specially:
+ *
+ * Prepare() is called once when a buffer is created
+ * (e.g. to reserve memory, so that typical payloads fit without reallocation).
+ *
+ * Reset() is called whenever a buffer is obtained from a pool via GetUnusedBuffer()
+ * (e.g. to clear size and content of a container cheaply - while keeping its capacity).
+ * Thus, publishers that fill buffers obtained via GetUnusedBuffer() do not reallocate
+ * memory in steady state.
+ *
+ * Specializations must set cCUSTOMIZED to true.
+ * They are registered when the first port with the respective type is created.
+ *
+ * \tparam T Port data type
+ */
+template <typename T>
+struct tBufferReuse
+{
+  enum { cCUSTOMIZED = false };
+
+  static void Prepare(T& buffer)
+  {}
+
+  static void Reset(T& buffer)
+  {}
+};
+
+template <typename T>
+struct tBufferReuse<std::vector<T>>
+{
+  enum { cCUSTOMIZED = true };
+
+  static void Prepare(std::vector<T>& buffer)
+  {}
+
+  static void Reset(std::vector<T>& buffer)
+  {
+    buffer.clear();
+  }
+};
+
+template <>
+struct tBufferReuse<std::string>
+{
+  enum { cCUSTOMIZED = true };
+
+  /*! Reserves a certain buffer size for RT capabilities with smaller payload */
+  static void Prepare(std::string& buffer)
+  {
+    buffer.reserve(512);
+  }
+
+  static void Reset(std::string& buffer)
+  {
+    buffer.clear();
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
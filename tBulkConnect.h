@@ -0,0 +1,114 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tBulkConnect.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tBulkConnect
+ *
+ * \b tBulkConnect
+ *
+ * Scope in which many ports are connected (or disconnected) efficiently.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__tBulkConnect_h__
+#define __plugins__data_ports__tBulkConnect_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/thread/tLock.h"
+#include "rrlib/util/tNoncopyable.h"
+#include "core/tRuntimeEnvironment.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/common/tAbstractDataPort.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Bulk-connect scope
+/*!
+ * While an object of this class exists, connecting and disconnecting data ports
+ * neither propagates strategies nor performs initial pushes.
+ * This is done once - for all connections that were changed - when the object is deleted.
+ * Push plans of ports with frozen topology are also rebuilt only once.
+ *
+ * Intended for setting up many connections at once (e.g. on application startup).
+ * The structure mutex is held while the object exists - so it should be short-lived
+ * and only be created by threads that are permitted to acquire the structure mutex.
+ * Scopes may be nested.
+ */
+class tBulkConnect : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tBulkConnect() :
+    lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex())
+  {
+    common::tAbstractDataPort::BeginBulkConnect();
+  }
+
+  ~tBulkConnect()
+  {
+    common::tAbstractDataPort::CommitBulkConnect();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Lock on structure mutex */
+  rrlib::thread::tLock lock;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -0,0 +1,135 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tConnectionTransaction.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tConnectionTransaction
+ *
+ * \b tConnectionTransaction
+ *
+ * Connection setup with batched initial pushing.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__tConnectionTransaction_h__
+#define __plugins__data_ports__tConnectionTransaction_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <memory>
+#include "rrlib/thread/tLock.h"
+#include "rrlib/util/tNoncopyable.h"
+#include "core/tRuntimeEnvironment.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/common/tAbstractDataPort.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Connection transaction
+/*!
+ * Like tBulkConnect - in addition, initial pushes are not performed while the structure mutex is held.
+ * Instead, they are collected (only the last one per destination port and direction is kept) and performed
+ * in one batch on Commit() - after the structure mutex has been released (unless the calling thread
+ * holds it otherwise) and optionally on multiple threads.
+ *
+ * If transactions are nested in other transactions (or in tBulkConnect scopes), initial pushes are
+ * performed when the outermost one is committed.
+ * Ports that are deleted while Commit() is performing initial pushes drop the initial pushes they are involved in.
+ */
+class tConnectionTransaction : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  tConnectionTransaction() :
+    lock(new rrlib::thread::tLock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex()))
+  {
+    common::tAbstractDataPort::BeginBulkConnect(true);
+  }
+
+  /*! Commits transaction if this has not been done yet */
+  ~tConnectionTransaction()
+  {
+    Commit();
+  }
+
+  /*!
+   * Commits transaction: propagates strategies, releases structure mutex and performs initial pushes.
+   * Calling this more than once has no effect.
+   *
+   * \param threads Number of threads to perform initial pushes with (1 performs all pushes in calling thread)
+   * \return Number of initial pushes that were collected (after removing duplicates - zero if transaction is nested)
+   */
+  size_t Commit(unsigned int threads = 1)
+  {
+    if (!lock)
+    {
+      return 0;
+    }
+    std::vector<common::tAbstractDataPort::tInitialPush> initial_pushes;
+    common::tAbstractDataPort::CommitBulkConnect(&initial_pushes);
+    lock.reset();
+    common::tAbstractDataPort::PerformInitialPushes(initial_pushes, threads);
+    return initial_pushes.size();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Lock on structure mutex (NULL once transaction has been committed) */
+  std::unique_ptr<rrlib::thread::tLock> lock;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
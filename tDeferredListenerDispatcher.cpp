@@ -0,0 +1,154 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tDeferredListenerDispatcher.cpp
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/data_ports/tDeferredListenerDispatcher.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tDeferredListenerDispatcher::tMailbox::tMailbox(tDeferredListenerDispatcher& dispatcher) :
+  dispatcher(&dispatcher)
+{}
+
+void tDeferredListenerDispatcher::tMailbox::Register()
+{
+  rrlib::thread::tLock lock(dispatcher->mutex);
+  dispatcher->mailboxes.push_back(this);
+}
+
+void tDeferredListenerDispatcher::tMailbox::Unregister()
+{
+  if (!dispatcher)
+  {
+    Clear();
+    return;
+  }
+  rrlib::thread::tLock lock(dispatcher->mutex);
+  dispatcher->mailboxes.erase(std::remove(dispatcher->mailboxes.begin(), dispatcher->mailboxes.end(), this), dispatcher->mailboxes.end());
+  Clear();
+  dispatcher = NULL;
+}
+
+tDeferredListenerDispatcher::tDeferredListenerDispatcher() :
+  mutex(),
+  mailboxes(),
+  worker_thread(),
+  stop_worker_thread(false)
+{}
+
+tDeferredListenerDispatcher::~tDeferredListenerDispatcher()
+{
+  StopWorkerThread();
+  rrlib::thread::tLock lock(mutex);
+  for (tMailbox * mailbox : mailboxes)
+  {
+    mailbox->dispatcher = NULL;
+    mailbox->Clear();
+  }
+  mailboxes.clear();
+}
+
+size_t tDeferredListenerDispatcher::ProcessEvents()
+{
+  rrlib::thread::tLock lock(mutex);
+  size_t delivered = 0;
+  for (tMailbox * mailbox : mailboxes)
+  {
+    delivered += mailbox->Deliver();
+  }
+  return delivered;
+}
+
+void tDeferredListenerDispatcher::StartWorkerThread(const rrlib::time::tDuration& cycle_time)
+{
+  if (worker_thread.joinable())
+  {
+    return;
+  }
+  stop_worker_thread.store(false);
+  worker_thread = std::thread([this, cycle_time]()
+  {
+    while (!stop_worker_thread.load(std::memory_order_relaxed))
+    {
+      ProcessEvents();
+      std::this_thread::sleep_for(cycle_time);
+    }
+    ProcessEvents();
+  });
+}
+
+void tDeferredListenerDispatcher::StopWorkerThread()
+{
+  if (worker_thread.joinable())
+  {
+    stop_worker_thread.store(true);
+    worker_thread.join();
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
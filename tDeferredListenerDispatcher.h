@@ -0,0 +1,194 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tDeferredListenerDispatcher.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tDeferredListenerDispatcher
+ *
+ * \b tDeferredListenerDispatcher
+ *
+ * Delivers port change events to deferred port listeners -
+ * in batches on a worker thread or at a sync point chosen by the user.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__tDeferredListenerDispatcher_h__
+#define __plugins__data_ports__tDeferredListenerDispatcher_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "rrlib/thread/tLock.h"
+#include "rrlib/time/time.h"
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Dispatcher for deferred port listeners
+/*!
+ * Port listeners that are added with AddPortListenerDeferred() are not called in the
+ * publishing thread. Instead, change events are placed in a bounded per-listener mailbox -
+ * which only takes a lock on the port buffer and a few atomic operations.
+ * Events are delivered to listeners by ProcessEvents() - either at a sync point chosen by
+ * the user (e.g. at the end of a control cycle) or by the dispatcher's worker thread.
+ * This way, slow listeners do not stall real-time publishers.
+ *
+ * If a mailbox is full, the oldest event is discarded.
+ * With a mailbox capacity of one (cLATEST_VALUE_ONLY), events are coalesced to the latest value.
+ *
+ * If a dispatcher is deleted before the ports with listeners it dispatches events for,
+ * their events are no longer delivered. Dispatcher and ports must not be deleted concurrently.
+ */
+class tDeferredListenerDispatcher : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Mailbox capacity that coalesces change events to the latest value */
+  enum { cLATEST_VALUE_ONLY = 1 };
+
+  /*!
+   * Mailbox with pending change events of a single deferred listener
+   * (base class - events are stored by subclasses)
+   */
+  class tMailbox : private rrlib::util::tNoncopyable
+  {
+  public:
+
+    /*!
+     * \param dispatcher Dispatcher that delivers events from this mailbox
+     */
+    tMailbox(tDeferredListenerDispatcher& dispatcher);
+
+    virtual ~tMailbox() {}
+
+    /*!
+     * Discards all pending events
+     */
+    virtual void Clear() = 0;
+
+    /*!
+     * Delivers all pending events to listener
+     *
+     * \return Number of events that were delivered
+     */
+    virtual size_t Deliver() = 0;
+
+    /*!
+     * Registers mailbox at dispatcher.
+     * Must be called once mailbox is completely constructed.
+     */
+    void Register();
+
+    /*!
+     * Unregisters mailbox from dispatcher and discards all pending events.
+     * Must be called before mailbox is deleted (typically, when port is deleted).
+     */
+    void Unregister();
+
+  private:
+
+    friend class tDeferredListenerDispatcher;
+
+    /*! Dispatcher that delivers events from this mailbox (NULL if dispatcher has been deleted) */
+    tDeferredListenerDispatcher* dispatcher;
+  };
+
+
+  tDeferredListenerDispatcher();
+
+  /*! Stops worker thread (if running) and detaches all remaining mailboxes */
+  ~tDeferredListenerDispatcher();
+
+  /*!
+   * Delivers all pending change events to deferred listeners.
+   * May be called at any sync point (while worker thread is running, it is called from there).
+   * Calls are serialized - so listeners are never called concurrently by the same dispatcher.
+   *
+   * \return Number of events that were delivered
+   */
+  size_t ProcessEvents();
+
+  /*!
+   * Starts worker thread that calls ProcessEvents() periodically
+   *
+   * \param cycle_time Time that worker thread sleeps between calls to ProcessEvents()
+   */
+  void StartWorkerThread(const rrlib::time::tDuration& cycle_time = std::chrono::milliseconds(10));
+
+  /*!
+   * Stops worker thread (if running) - after it has delivered the events that are currently pending
+   */
+  void StopWorkerThread();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Mutex for mailbox list and event delivery */
+  rrlib::thread::tMutex mutex;
+
+  /*! Registered mailboxes */
+  std::vector<tMailbox*> mailboxes;
+
+  /*! Worker thread (not joinable if not running) */
+  std::thread worker_thread;
+
+  /*! Signals worker thread to stop */
+  std::atomic<bool> stop_worker_thread;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
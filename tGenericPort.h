@@ -47,7 +47,10 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/data_ports/api/tGenericPortImplementation.h"
+#include "plugins/data_ports/tAsyncPull.h"
+#include "plugins/data_ports/tDeferredListenerDispatcher.h"
 #include "plugins/data_ports/tEvent.h"
+#include "plugins/data_ports/common/tStartupProfiler.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -67,6 +70,10 @@ template <typename LISTENER, bool FIRST_LISTENER>
 class tPortListenerAdapterGeneric;
 template <typename LISTENER, bool FIRST_LISTENER>
 class tPortListenerAdapterGenericForPointer;
+template <typename LISTENER, typename TPointer>
+class tDeferredListenerMailbox;
+template <typename TMailbox, typename TAdapter>
+class tDeferredPortListenerAdapter;
 }
 
 //----------------------------------------------------------------------
@@ -107,6 +114,7 @@ public:
   template <typename ... ARGS>
   tGenericPort(const ARGS&... args)
   {
+    common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::PORT_CREATION);
     tConstructorArguments<common::tAbstractDataPortCreationInfo> creation_info(args...);
     if ((creation_info.data_type.GetTypeTraits() & rrlib::rtti::trait_flags::cIS_BINARY_SERIALIZABLE) == 0)
     {
@@ -114,6 +122,7 @@ public:
     }
     implementation = api::tGenericPortImplementation::GetImplementation(creation_info.data_type);
     SetWrapped(implementation->CreatePort(creation_info));
+    profiler_scope.SetPort(GetWrapped());
   }
 
   /*!
@@ -140,6 +149,25 @@ public:
   template <typename TListener>
   void AddPortListenerForPointer(TListener& listener);
 
+  /*!
+   * Adds listener that is not called in the publishing thread.
+   * Change events are placed in a mailbox and delivered by the specified dispatcher
+   * (on its worker thread or at a sync point - see tDeferredListenerDispatcher).
+   *
+   * \param listener Listener to add
+   * \param dispatcher Dispatcher that delivers change events to listener (must not be deleted before port)
+   * \param mailbox_capacity Maximum number of pending change events (>= 1). If mailbox is full, oldest event is discarded.
+   *                         The default value coalesces events to the latest value.
+   *
+   * \tparam LISTENER Listener class needs to implement a method
+   * void OnPortChange(tPortDataPointer<const rrlib::rtti::tGenericObject>& value, tChangeContext& change_context)
+   *
+   * (It's preferred to add listeners before port is initialized)
+   * (Note: Buffer in 'value' always has data type of port backend (e.g. tNumber instead of double)
+   */
+  template <typename TListener>
+  void AddPortListenerDeferred(TListener& listener, tDeferredListenerDispatcher& dispatcher, size_t mailbox_capacity = tDeferredListenerDispatcher::cLATEST_VALUE_ONLY);
+
   /*!
    * \param listener Listener to add
    *
@@ -231,6 +259,18 @@ public:
     return implementation->GetPointer(*GetWrapped(), strategy);
   }
 
+  /*!
+   * Starts pulling port's value asynchronously (on worker threads).
+   * If the same port is already being pulled asynchronously, the pending pull operation is joined.
+   * In contrast to GetPointer(), this does not block caller while pull request handlers are executed.
+   *
+   * \return Handle to pull operation (provides pulled value - or last known value on timeout)
+   */
+  inline tAsyncPull<tGenericPort> GetPointerAsync() const
+  {
+    return tAsyncPull<tGenericPort>(*this);
+  }
+
   /*!
    * \return Port's default value (NULL if none has been set)
    */
@@ -355,5 +395,6 @@ private:
 #include "plugins/data_ports/tInputPort.h"
 #include "plugins/data_ports/tGenericPort.hpp"
 #include "plugins/data_ports/api/tPortListenerAdapter.h"
+#include "plugins/data_ports/api/tDeferredPortListenerAdapter.h"
 
 #endif
@@ -69,46 +69,31 @@ class tPortListenerAdapterSimple;
 template <typename TListener>
 void tGenericPort::AddPortListener(TListener& listener)
 {
-  if (this->GetWrapped()->GetPortListener())
-  {
-    typedef api::tPortListenerAdapterGeneric<TListener, false> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener, *this->GetWrapped()->GetPortListener()));
-  }
-  else
-  {
-    typedef api::tPortListenerAdapterGeneric<TListener, true> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener));
-  }
+  typedef api::tPortListenerAdapterGeneric<TListener, true> tAdapter;
+  this->GetWrapped()->AddPortListenerRaw(*new tAdapter(listener), &common::tPortListenerTable::DispatchTo<tAdapter>);
 }
 
 template <typename TListener>
 void tGenericPort::AddPortListenerForPointer(TListener& listener)
 {
-  if (this->GetWrapped()->GetPortListener())
-  {
-    typedef api::tPortListenerAdapterGenericForPointer<TListener, false> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener, *this->GetWrapped()->GetPortListener()));
-  }
-  else
-  {
-    typedef api::tPortListenerAdapterGenericForPointer<TListener, true> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener));
-  }
+  typedef api::tPortListenerAdapterGenericForPointer<TListener, true> tAdapter;
+  this->GetWrapped()->AddPortListenerRaw(*new tAdapter(listener), &common::tPortListenerTable::DispatchTo<tAdapter>);
+}
+
+template <typename TListener>
+void tGenericPort::AddPortListenerDeferred(TListener& listener, tDeferredListenerDispatcher& dispatcher, size_t mailbox_capacity)
+{
+  assert(mailbox_capacity >= 1);
+  typedef api::tDeferredListenerMailbox<TListener, tPortDataPointer<const rrlib::rtti::tGenericObject>> tMailbox;
+  typedef api::tDeferredPortListenerAdapter<tMailbox, api::tPortListenerAdapterGenericForPointer<tMailbox, true>> tAdapter;
+  this->GetWrapped()->AddPortListenerRaw(*new tAdapter(listener, dispatcher, mailbox_capacity), &common::tPortListenerTable::DispatchTo<tAdapter>);
 }
 
 template <typename TListener>
 void tGenericPort::AddPortListenerSimple(TListener& listener)
 {
-  if (this->GetWrapped()->GetPortListener())
-  {
-    typedef api::tPortListenerAdapterSimple<TListener, false> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener, *this->GetWrapped()->GetPortListener()));
-  }
-  else
-  {
-    typedef api::tPortListenerAdapterSimple<TListener, true> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener));
-  }
+  typedef api::tPortListenerAdapterSimple<TListener, true> tAdapter;
+  this->GetWrapped()->AddPortListenerRaw(*new tAdapter(listener), &common::tPortListenerTable::DispatchTo<tAdapter>);
 }
 
 //----------------------------------------------------------------------
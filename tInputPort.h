@@ -46,6 +46,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/tDeferredListenerDispatcher.h"
 #include "plugins/data_ports/tPort.h"
 #include "plugins/data_ports/api/tPortImplementationTypeTrait.h"
 
@@ -66,6 +67,10 @@ template <typename LISTENER, typename T, tPortImplementationType TPortImplementa
 class tPortListenerAdapter;
 template <typename LISTENER, typename T, bool FIRST_LISTENER>
 class tPortListenerAdapterForPointer;
+template <typename LISTENER, typename TPointer>
+class tDeferredListenerMailbox;
+template <typename TMailbox, typename TAdapter>
+class tDeferredPortListenerAdapter;
 }
 
 //----------------------------------------------------------------------
@@ -142,6 +147,24 @@ public:
   template <typename TListener>
   void AddPortListenerForPointer(TListener& listener);
 
+  /*!
+   * Adds listener that is not called in the publishing thread.
+   * Change events are placed in a mailbox and delivered by the specified dispatcher
+   * (on its worker thread or at a sync point - see tDeferredListenerDispatcher).
+   *
+   * \param listener Listener to add
+   * \param dispatcher Dispatcher that delivers change events to listener (must not be deleted before port)
+   * \param mailbox_capacity Maximum number of pending change events (>= 1). If mailbox is full, oldest event is discarded.
+   *                         The default value coalesces events to the latest value.
+   *
+   * \tparam LISTENER Listener class needs to implement a method
+   * void OnPortChange(tPortDataPointer<const T>& value, tChangeContext& change_context)
+   *
+   * (It's preferred to add listeners before port is initialized)
+   */
+  template <typename TListener>
+  void AddPortListenerDeferred(TListener& listener, tDeferredListenerDispatcher& dispatcher, size_t mailbox_capacity = tDeferredListenerDispatcher::cLATEST_VALUE_ONLY);
+
   /*!
    * \param listener Listener to add
    *
@@ -219,6 +242,24 @@ public:
     return tPortBuffers<tPortDataPointer<const T>>(this->GetWrapped()->DequeueAllRaw(), *this->GetWrapped());
   }
 
+  /*!
+   * Dequeue all elements currently in input queue and append their values to the provided vector
+   * (oldest first).
+   * Values are copied to contiguous storage in one pass and buffer locks are released in bulk.
+   * Thus, bursts of values can be processed efficiently (e.g. with SIMD instructions).
+   * Reserving capacity in 'result' up front avoids allocations.
+   * (only available for 'cheaply copied' types)
+   *
+   * \param result Vector to append values to
+   * \param timestamps If not NULL, timestamps of values are appended to this vector
+   * \return Number of dequeued values
+   */
+  template <bool AVAILABLE = tPort<T>::cPASS_BY_VALUE>
+  inline typename std::enable_if<AVAILABLE, size_t>::type DequeueAllInto(std::vector<T>& result, std::vector<rrlib::time::tTimestamp>* timestamps = NULL)
+  {
+    return DequeueAll().PopAllInto(result, timestamps);
+  }
+
   /*!
    * \return Has port changed since last changed-flag-reset?
    */
@@ -321,5 +362,6 @@ private:
 #include "plugins/data_ports/tGenericPort.h"
 #include "plugins/data_ports/tInputPort.hpp"
 #include "plugins/data_ports/api/tPortListenerAdapter.h"
+#include "plugins/data_ports/api/tDeferredPortListenerAdapter.h"
 
 #endif
@@ -69,46 +69,31 @@ class tPortListenerAdapterSimple;
 template <typename T> template <typename TListener>
 void tInputPort<T>::AddPortListener(TListener& listener)
 {
-  if (this->GetWrapped()->GetPortListener())
-  {
-    typedef api::tPortListenerAdapter<TListener, T, api::tPortImplementationTypeTrait<T>::type, false> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener, *this->GetWrapped()->GetPortListener()));
-  }
-  else
-  {
-    typedef api::tPortListenerAdapter<TListener, T, api::tPortImplementationTypeTrait<T>::type, true> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener));
-  }
+  typedef api::tPortListenerAdapter<TListener, T, api::tPortImplementationTypeTrait<T>::type, true> tAdapter;
+  this->GetWrapped()->AddPortListenerRaw(*new tAdapter(listener), &common::tPortListenerTable::DispatchTo<tAdapter>);
 }
 
 template <typename T> template <typename TListener>
 void tInputPort<T>::AddPortListenerForPointer(TListener& listener)
 {
-  if (this->GetWrapped()->GetPortListener())
-  {
-    typedef api::tPortListenerAdapterForPointer<TListener, T, false> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener, *this->GetWrapped()->GetPortListener()));
-  }
-  else
-  {
-    typedef api::tPortListenerAdapterForPointer<TListener, T, true> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener));
-  }
+  typedef api::tPortListenerAdapterForPointer<TListener, T, true> tAdapter;
+  this->GetWrapped()->AddPortListenerRaw(*new tAdapter(listener), &common::tPortListenerTable::DispatchTo<tAdapter>);
+}
+
+template <typename T> template <typename TListener>
+void tInputPort<T>::AddPortListenerDeferred(TListener& listener, tDeferredListenerDispatcher& dispatcher, size_t mailbox_capacity)
+{
+  assert(mailbox_capacity >= 1);
+  typedef api::tDeferredListenerMailbox<TListener, tPortDataPointer<const T>> tMailbox;
+  typedef api::tDeferredPortListenerAdapter<tMailbox, api::tPortListenerAdapterForPointer<tMailbox, T, true>> tAdapter;
+  this->GetWrapped()->AddPortListenerRaw(*new tAdapter(listener, dispatcher, mailbox_capacity), &common::tPortListenerTable::DispatchTo<tAdapter>);
 }
 
 template <typename T> template <typename TListener>
 void tInputPort<T>::AddPortListenerSimple(TListener& listener)
 {
-  if (this->GetWrapped()->GetPortListener())
-  {
-    typedef api::tPortListenerAdapterSimple<TListener, false> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener, *this->GetWrapped()->GetPortListener()));
-  }
-  else
-  {
-    typedef api::tPortListenerAdapterSimple<TListener, true> tAdapter;
-    this->GetWrapped()->SetPortListener(new tAdapter(listener));
-  }
+  typedef api::tPortListenerAdapterSimple<TListener, true> tAdapter;
+  this->GetWrapped()->AddPortListenerRaw(*new tAdapter(listener), &common::tPortListenerTable::DispatchTo<tAdapter>);
 }
 
 //----------------------------------------------------------------------
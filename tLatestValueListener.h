@@ -0,0 +1,165 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tLatestValueListener.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tLatestValueListener
+ *
+ * \b tLatestValueListener
+ *
+ * Port listener that only counts changes - the latest value is obtained lazily by the consumer.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__tLatestValueListener_h__
+#define __plugins__data_ports__tLatestValueListener_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/tInputPort.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Coalescing "latest value only" port listener
+/*!
+ * Listener for consumers that only need a port's newest value at a low rate (e.g. GUI or logging).
+ * In the publishing thread, it merely increments an atomic change counter -
+ * neither the port buffer nor its data are accessed and no change context is created.
+ * The consumer polls PendingChanges() and obtains the latest value from the port with GetLatest().
+ * All changes since the last call to GetLatest() are thereby coalesced.
+ *
+ * A listener is attached to a single port on construction. It must not be deleted before this port.
+ * Only a single thread should consume values.
+ */
+template <typename T>
+class tLatestValueListener : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param port Port to attach listener to (it's preferred to attach listeners before port is initialized)
+   */
+  tLatestValueListener(const tInputPort<T>& port) :
+    port(port),
+    change_counter(0),
+    consumed_changes(0)
+  {
+    typedef api::tPortListenerAdapterCounting<tLatestValueListener> tAdapter;
+    this->port.GetWrapped()->AddPortListenerRaw(*new tAdapter(*this), &common::tPortListenerTable::DispatchTo<tAdapter>);
+  }
+
+  /*!
+   * Called by port listener adapter in publishing thread
+   */
+  inline void CountChange()
+  {
+    change_counter.fetch_add(1, std::memory_order_release);
+  }
+
+  /*!
+   * \return Total number of changes of port's value since listener was attached
+   */
+  uint64_t GetChangeCount() const
+  {
+    return change_counter.load(std::memory_order_acquire);
+  }
+
+  /*!
+   * Obtains port's latest value - and marks all changes until now as consumed
+   *
+   * \return Port's current value
+   */
+  tPortDataPointer<const T> GetLatest()
+  {
+    consumed_changes = GetChangeCount();
+    return port.GetPointer();
+  }
+
+  /*!
+   * Obtains port's latest value - and marks all changes until now as consumed
+   *
+   * \param result Buffer to copy port's current value to
+   */
+  void GetLatest(T& result)
+  {
+    consumed_changes = GetChangeCount();
+    port.Get(result);
+  }
+
+  /*!
+   * \return Number of changes since last call to GetLatest() (zero if port's value has not changed)
+   */
+  uint64_t PendingChanges() const
+  {
+    return GetChangeCount() - consumed_changes;
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Port that listener is attached to */
+  tInputPort<T> port;
+
+  /*! Number of changes of port's value since listener was attached */
+  std::atomic<uint64_t> change_counter;
+
+  /*! Value of change counter on last call to GetLatest() */
+  uint64_t consumed_changes;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
@@ -46,6 +46,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/tAsyncPull.h"
 #include "plugins/data_ports/tPortCreationInfo.h"
 #include "plugins/data_ports/api/tPortImplementation.h"
 #include "plugins/data_ports/tPortBuffers.h"
@@ -134,11 +135,13 @@ public:
   template <typename TArg1, typename TArg2, typename ... TRest>
   tPort(const TArg1& arg1, const TArg2& arg2, const TRest&... args)
   {
+    common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::PORT_CREATION);
     tConstructorArguments<tPortCreationInfo<T>> creation_info(arg1, arg2, args...);
     creation_info.data_type = rrlib::rtti::tDataType<tPortBuffer>();
     if (!(creation_info.flags.Raw() & core::tFrameworkElementFlags(core::tFrameworkElementFlag::DELETED).Raw())) // do not create port, if deleted flag is set
     {
       SetWrapped(tImplementation::CreatePort(creation_info));
+      profiler_scope.SetPort(GetWrapped());
       GetWrapped()->SetWrapperDataType(rrlib::rtti::tDataType<T>());
       if (creation_info.DefaultValueSet())
       {
@@ -209,6 +212,18 @@ public:
     tImplementation::CopyCurrentPortValue(*GetWrapped(), result, timestamp);
   }
 
+  /*!
+   * Starts pulling port's value asynchronously (on worker threads).
+   * If the same port is already being pulled asynchronously, the pending pull operation is joined.
+   * In contrast to Get(), this does not block caller while pull request handlers are executed.
+   *
+   * \return Handle to pull operation (provides pulled value - or last known value on timeout)
+   */
+  inline tAsyncPull<tPort> GetAsync() const
+  {
+    return tAsyncPull<tPort>(*this);
+  }
+
   /*!
    * (throws a std::runtime_error if port is not bounded)
    *
@@ -238,11 +253,12 @@ public:
   /*!
    * Gets Port's current value in buffer
    *
+   * \param strategy Strategy to use for get operation
    * \return Buffer with port's current value with read lock.
    */
-  inline tPortDataPointer<const T> GetPointer() const
+  inline tPortDataPointer<const T> GetPointer(tStrategy strategy = tStrategy::DEFAULT) const
   {
-    return tImplementation::GetPointer(*GetWrapped());
+    return tImplementation::GetPointer(*GetWrapped(), strategy);
   }
 
   /*!
@@ -44,6 +44,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/data_ports/api/tPortBufferReturnCustomization.h"
+#include "plugins/data_ports/common/tLockReleaseBatch.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -99,6 +100,13 @@ public:
     std::swap(queue_fragment, other.queue_fragment);
   }
 
+  ~tPortBuffers()
+  {
+    // Release locks of remaining elements in bulk
+    common::tLockReleaseBatch<tPortBase> lock_release;
+    lock_release.ReleaseAll(queue_fragment);
+  }
+
   /*! Move assignment */
   tPortBuffers& operator=(tPortBuffers && other)
   {
@@ -136,6 +144,22 @@ public:
     return tImplementation::ToDesiredType(queue_fragment.PopBack(), *port);
   }
 
+  /*!
+   * Removes all (remaining) elements from queue fragment and appends their values to the provided vector
+   * - in the order they were enqueued.
+   * Values are copied to contiguous storage in one pass and buffer locks are released in bulk.
+   * (only available for plain cheaply-copied types)
+   *
+   * \param result Vector to append values to
+   * \param timestamps If not NULL, timestamps of values are appended to this vector
+   * \return Number of values appended
+   */
+  template <bool AVAILABLE = tIsCheaplyCopiedType<T>::value>
+  typename std::enable_if<AVAILABLE, size_t>::type PopAllInto(std::vector<T>& result, std::vector<rrlib::time::tTimestamp>* timestamps = NULL)
+  {
+    return tImplementation::AppendAll(queue_fragment, result, timestamps);
+  }
+
   /*!
    * Returns and removes an element from the queue fragment
    *
@@ -225,6 +249,22 @@ public:
     return tImplementation::template ToDesiredType<tQueueEntry>(temp);
   }
 
+  /*!
+   * Removes all (remaining) elements from queue fragment and appends their values to the provided vector
+   * - in the order they were enqueued.
+   * Values are copied to contiguous storage in one pass and buffer locks are released in bulk.
+   * (only available for plain cheaply-copied types)
+   *
+   * \param result Vector to append values to
+   * \param timestamps If not NULL, timestamps of values are appended to this vector
+   * \return Number of values appended
+   */
+  template <bool AVAILABLE = tIsCheaplyCopiedType<T>::value>
+  typename std::enable_if<AVAILABLE, size_t>::type PopAllInto(std::vector<T>& result, std::vector<rrlib::time::tTimestamp>* timestamps = NULL)
+  {
+    return tImplementation::AppendAll(queue, result, timestamps);
+  }
+
   /*!
    * Returns and removes an element from the queue fragment
    *
@@ -45,6 +45,7 @@
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/data_ports/common/tAbstractDataPortCreationInfo.h"
+#include "plugins/data_ports/common/tStartupProfiler.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -95,6 +96,7 @@ public:
       FINROC_LOG_PRINT_STATIC(DEBUG_WARNING, "Bounds were not set");
       return result;
     }
+    common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::VALUE_DESERIALIZATION);
     rrlib::serialization::tInputStream is(bounds);
     is >> result;
     return result;
@@ -120,6 +122,7 @@ public:
       FINROC_LOG_PRINT_STATIC(DEBUG_WARNING, "Default value was not set");
       return;
     }
+    common::tStartupProfiler::tScope profiler_scope(common::tStartupPhase::VALUE_DESERIALIZATION);
     rrlib::serialization::tInputStream is(default_value);
     is >> buffer;
   }
@@ -0,0 +1,346 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tPublishBatch.h
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * \brief   Contains tPublishBatch
+ *
+ * \b tPublishBatch
+ *
+ * Collects values for many output ports and publishes them in one pass.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__data_ports__tPublishBatch_h__
+#define __plugins__data_ports__tPublishBatch_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include "rrlib/util/tNoncopyable.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/tOutputPort.h"
+#include "plugins/data_ports/standard/tEpochReclamation.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace data_ports
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+namespace api
+{
+template <typename T, bool STANDARD>
+struct tPublishBatchImplementation;
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Batch of values to publish
+/*!
+ * Collects values for many output ports (typically all output ports of a module)
+ * and publishes them in one pass.
+ *
+ * Compared to calling tOutputPort::Publish() for every port, the batch
+ * - looks up the current thread's buffer pools (thread-local or global) only once (on construction)
+ * - copies values to port buffers when they are added (not while publishing)
+ * - prefetches ports and buffers of upcoming entries - as well as the push destinations
+ *   of ports with frozen topology (see tAbstractDataPort::SetTopologyFrozen()) - while publishing.
+ * Apart from that, every value is published by a separate publishing operation
+ * (with its own checks and buffer locks) - exactly as tOutputPort::Publish() does.
+ *
+ * A batch must only be used by the thread that created it.
+ * Buffers of values that were added but not published are recycled
+ * when the batch is cleared or deleted.
+ */
+class tPublishBatch : private rrlib::util::tNoncopyable
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*!
+   * \param expected_size Expected number of values added per batch (reserves memory for entries)
+   */
+  tPublishBatch(size_t expected_size = 0) :
+#ifndef RRLIB_SINGLE_THREADED
+    thread_local_buffers(optimized::tThreadLocalBufferPools::Get() != NULL),
+#else
+    thread_local_buffers(false),
+#endif
+    entries()
+  {
+    entries.reserve(expected_size);
+  }
+
+  ~tPublishBatch()
+  {
+    Clear();
+  }
+
+  /*!
+   * Adds value to batch.
+   * It is copied to a port buffer immediately.
+   *
+   * \param port Output port to publish value through
+   * \param value Value to publish
+   * \param timestamp Timestamp to attach to value
+   */
+  template <typename T>
+  void Add(tOutputPort<T>& port, const T& value, const rrlib::time::tTimestamp& timestamp = rrlib::time::cNO_TIME)
+  {
+    typedef api::tPublishBatchImplementation<T, std::is_same<typename tPort<T>::tPortBackend, standard::tStandardPort>::value> tImplementation;
+    tEntry entry;
+    entry.port = port.GetWrapped();
+    entry.buffer = tImplementation::CopyToBuffer(*port.GetWrapped(), value, timestamp, thread_local_buffers);
+    if (!entry.buffer)
+    {
+      return; // already published (no buffers involved in this port implementation)
+    }
+    entry.publish = &tImplementation::Publish;
+    entry.recycle = &tImplementation::Recycle;
+    entries.push_back(entry);
+  }
+
+  /*!
+   * Removes all values from batch without publishing them
+   */
+  void Clear()
+  {
+    for (tEntry & entry : entries)
+    {
+      entry.recycle(entry.buffer, thread_local_buffers);
+    }
+    entries.clear();
+  }
+
+  /*!
+   * \return True if batch contains no values
+   */
+  bool Empty() const
+  {
+    return entries.empty();
+  }
+
+  /*!
+   * Publishes all values in batch (in the order they were added).
+   * Batch is empty afterwards and can be reused.
+   */
+  void Publish()
+  {
+    standard::tEpochReclamation::tReadGuard epoch_guard;  // pinned once for all push plans and listener tables used in batch
+    const size_t size = entries.size();
+    for (size_t i = 0; i < size && i < 2; i++)
+    {
+      __builtin_prefetch(entries[i].port);
+      __builtin_prefetch(entries[i].buffer);
+    }
+    for (size_t i = 0; i < size; i++)
+    {
+      if (i + 2 < size)
+      {
+        __builtin_prefetch(entries[i + 2].port);
+        __builtin_prefetch(entries[i + 2].buffer);
+      }
+      if (i + 1 < size)
+      {
+        PrefetchPushDestinations(*entries[i + 1].port);
+      }
+      tEntry& entry = entries[i];
+      entry.publish(*entry.port, entry.buffer, thread_local_buffers);
+    }
+    entries.clear();
+  }
+
+  /*!
+   * \return Number of values in batch
+   */
+  size_t Size() const
+  {
+    return entries.size();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Value in batch */
+  struct tEntry
+  {
+    /*! Port to publish value through */
+    common::tAbstractDataPort* port;
+
+    /*! Buffer (manager) containing value */
+    void* buffer;
+
+    /*! Publishes buffer through port */
+    void (*publish)(common::tAbstractDataPort& port, void* buffer, bool thread_local_buffers);
+
+    /*! Recycles buffer without publishing it */
+    void (*recycle)(void* buffer, bool thread_local_buffers);
+  };
+
+  /*! Maximum number of push destinations that are prefetched per entry */
+  enum { cPREFETCHED_DESTINATIONS = 4 };
+
+  /*! Were buffers taken from thread-local buffer pools? (determined once on construction) */
+  const bool thread_local_buffers;
+
+  /*! Values in batch */
+  std::vector<tEntry> entries;
+
+
+  /*!
+   * Prefetches first push destinations of port (only possible for ports with push plan)
+   *
+   * \param port Port whose value is published next
+   */
+  static void PrefetchPushDestinations(const common::tAbstractDataPort& port)
+  {
+    const common::tAbstractDataPort::tPushPlan* push_plan = port.GetPushPlan();
+    if (push_plan)
+    {
+      const size_t count = std::min<size_t>(push_plan->size(), cPREFETCHED_DESTINATIONS);
+      for (size_t i = 0; i < count; i++)
+      {
+        __builtin_prefetch((*push_plan)[i].target);
+      }
+    }
+  }
+};
+
+namespace api
+{
+
+/*!
+ * Implementation of tPublishBatch operations for 'cheaply copied' types
+ */
+template <typename T, bool STANDARD>
+struct tPublishBatchImplementation
+{
+  typedef typename tPort<T>::tImplementation tImplementation;
+  typedef typename tPort<T>::tPortBuffer tPortBuffer;
+
+#ifndef RRLIB_SINGLE_THREADED
+  static void* CopyToBuffer(common::tAbstractDataPort& port, const T& value, const rrlib::time::tTimestamp& timestamp, bool thread_local_buffers)
+  {
+    uint32_t type_index = static_cast<optimized::tCheapCopyPort&>(port).GetCheaplyCopyableTypeIndex();
+    optimized::tCheaplyCopiedBufferManager* buffer = thread_local_buffers ?
+        static_cast<optimized::tCheaplyCopiedBufferManager*>(optimized::tThreadLocalBufferPools::Get()->GetUnusedBuffer(type_index).release()) :
+        optimized::tGlobalBufferPools::Instance().GetUnusedBuffer(type_index).release();
+    buffer->SetTimestamp(timestamp);
+    tImplementation::Assign(buffer->GetObject().template GetData<tPortBuffer>(), value);
+    return buffer;
+  }
+
+  static void Publish(common::tAbstractDataPort& port, void* buffer, bool thread_local_buffers)
+  {
+    optimized::tCheapCopyPort& cc_port = static_cast<optimized::tCheapCopyPort&>(port);
+    optimized::tCheaplyCopiedBufferManager* manager = static_cast<optimized::tCheaplyCopiedBufferManager*>(buffer);
+    if (thread_local_buffers)
+    {
+      common::tPublishOperation<optimized::tCheapCopyPort, typename optimized::tCheapCopyPort::tPublishingDataThreadLocalBuffer> publish_operation(static_cast<optimized::tThreadLocalBufferManager*>(manager), true);
+      publish_operation.template Execute<false, tChangeStatus::CHANGED, false, false>(cc_port);
+    }
+    else
+    {
+      typename optimized::tCheapCopyPort::tUnusedManagerPointer pointer(manager);
+      const common::tAbstractDataPort::tPushPlan* push_plan = cc_port.GetPushPlan();  // epoch is pinned in tPublishBatch::Publish()
+      common::tPublishOperation<optimized::tCheapCopyPort, typename optimized::tCheapCopyPort::tPublishingDataGlobalBuffer> publish_operation(pointer, cc_port.GetPublishLockCount(push_plan));
+      publish_operation.template Execute<false, tChangeStatus::CHANGED, false, false>(cc_port, push_plan);
+    }
+  }
+
+  static void Recycle(void* buffer, bool thread_local_buffers)
+  {
+    typename optimized::tCheapCopyPort::tUnusedManagerPointer pointer(static_cast<optimized::tCheaplyCopiedBufferManager*>(buffer));
+  }
+
+#else
+
+  // Single-threaded ports store their value directly - so values are published right away
+  static void* CopyToBuffer(common::tAbstractDataPort& port, const T& value, const rrlib::time::tTimestamp& timestamp, bool thread_local_buffers)
+  {
+    tImplementation::CopyAndPublish(static_cast<typename tPort<T>::tPortBackend&>(port), value, timestamp);
+    return NULL;
+  }
+
+  static void Publish(common::tAbstractDataPort& port, void* buffer, bool thread_local_buffers)
+  {}
+
+  static void Recycle(void* buffer, bool thread_local_buffers)
+  {}
+#endif
+};
+
+/*!
+ * Implementation of tPublishBatch operations for standard types
+ */
+template <typename T>
+struct tPublishBatchImplementation<T, true>
+{
+  static void* CopyToBuffer(common::tAbstractDataPort& port, const T& value, const rrlib::time::tTimestamp& timestamp, bool thread_local_buffers)
+  {
+    standard::tStandardPort::tUnusedManagerPointer buffer = static_cast<standard::tStandardPort&>(port).GetUnusedBufferRaw();
+    buffer->SetTimestamp(timestamp);
+    rrlib::rtti::GenericOperations<T>::DeepCopy(value, buffer->GetObject().template GetData<T>());
+    return buffer.release();
+  }
+
+  static void Publish(common::tAbstractDataPort& port, void* buffer, bool thread_local_buffers)
+  {
+    standard::tStandardPort::tUnusedManagerPointer pointer(static_cast<standard::tPortBufferManager*>(buffer));
+    static_cast<standard::tStandardPort&>(port).Publish(pointer);
+  }
+
+  static void Recycle(void* buffer, bool thread_local_buffers)
+  {
+    standard::tStandardPort::tUnusedManagerPointer pointer(static_cast<standard::tPortBufferManager*>(buffer));
+  }
+};
+
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif
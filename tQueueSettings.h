@@ -83,10 +83,14 @@ public:
    *                             A value of -1 indicates that the queue has (virtually) no size limit.
    *                             This is somewhat dangerous: If elements in a queue of unlimited size are
    *                             not fetched, this causes continuous memory allocation for new buffers.
+   * \param ring_buffer_for_single_source Use a lock-free ring buffer with fixed memory footprint while port has
+   *                                      only a single source (incoming connection)?
+   *                                      Only relevant for FIFO queues with limited size.
    */
-  explicit tQueueSettings(bool dequeue_all_queue, int maximum_queue_length = -1) :
+  explicit tQueueSettings(bool dequeue_all_queue, int maximum_queue_length = -1, bool ring_buffer_for_single_source = false) :
     dequeue_all_queue(dequeue_all_queue),
-    maximum_queue_length(maximum_queue_length)
+    maximum_queue_length(maximum_queue_length),
+    ring_buffer_for_single_source(ring_buffer_for_single_source)
   {}
 
   /*!
@@ -105,6 +109,14 @@ public:
     return maximum_queue_length;
   }
 
+  /*!
+   * \return Use ring buffer while port has only a single source?
+   */
+  bool RingBufferForSingleSource() const
+  {
+    return ring_buffer_for_single_source;
+  }
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -123,6 +135,9 @@ private:
    */
   int maximum_queue_length;
 
+  /*! Use ring buffer while port has only a single source? */
+  bool ring_buffer_for_single_source;
+
 };
 
 //----------------------------------------------------------------------
@@ -90,6 +90,26 @@ public:
     pools->SafeDelete();
   }
 
+  /*!
+   * \return Statistics on this thread's buffer pool for the specified type
+   */
+  optimized::tBufferPoolStatistics GetPoolStatistics(uint32_t cheaply_copied_type_index) const
+  {
+    return pools->GetPoolStatistics(cheaply_copied_type_index);
+  }
+
+  /*!
+   * Fills this thread's buffer pools up to the size determined by the current sizing policy
+   * (see optimized::tThreadSpecificBufferPools::PrewarmPools()).
+   * Must be called by the thread that owns this object.
+   *
+   * \return Number of buffers that were allocated
+   */
+  size_t PrewarmPools()
+  {
+    return pools->PrewarmPools();
+  }
+
 private:
 
   /*! Pointer to allocated pools */
@@ -0,0 +1,576 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/data_ports/tests/benchmarks.cpp
+ *
+ * \author  Finroc GbR
+ *
+ * \date    2026-10-16
+ *
+ * Micro-benchmarks for publishing and getting values via data ports.
+ *
+ * Measures publish latency, Get()/GetPointer() latency and fan-out throughput
+ * for all port backends (cheaply-copied types with global and thread-local buffers,
+ * standard ports - and single-threaded cheap copy ports if compiled with RRLIB_SINGLE_THREADED).
+ * Payload size, number of connected input ports and number of concurrent reader threads are varied.
+ * For cheaply-copied types, payload size is varied with the fixed-size type tCheapCopyPayload (backend 'cheap_copy_payload').
+ *
+ * Results are printed to stdout as CSV lines - one per measurement:
+ *   backend,operation,payload_bytes,fan_out,reader_threads,iterations,ns_per_operation
+ *
+ * Publishing the values of many output ports via tPublishBatch is compared to calling Publish() on every port
+ * (operations 'publish_per_port' and 'publish_batch' - fan_out is the number of output ports then - each connected to one input port).
+ *
+ * Furthermore, the 32 bit and 64 bit layouts of buffer reference counters are compared
+ * (backends 'reference_counter_32' and 'reference_counter_64' - see data_ports::cWIDE_REFERENCE_COUNTERS).
+ *
+ * Optional command line argument: number of iterations per measurement (default: 100000)
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "core/tRuntimeEnvironment.h"
+#include "rrlib/rtti/rtti.h"
+#include "rrlib/serialization/serialization.h"
+#include "rrlib/thread/tThread.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/data_ports/tInputPort.h"
+#include "plugins/data_ports/tOutputPort.h"
+#include "plugins/data_ports/tPublishBatch.h"
+#include "plugins/data_ports/tThreadLocalBufferManagement.h"
+#include "plugins/data_ports/common/tReferenceAndReuseCounter.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace finroc::data_ports;
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+typedef std::chrono::steady_clock tClock;
+
+/*!
+ * Cheaply-copied payload of fixed size (to vary payload size with cheap copy ports)
+ */
+template <size_t SIZE>
+struct tCheapCopyPayload
+{
+  std::array<uint8_t, SIZE> data;
+};
+
+template <size_t SIZE>
+rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tCheapCopyPayload<SIZE>& payload)
+{
+  for (uint8_t byte : payload.data)
+  {
+    stream << byte;
+  }
+  return stream;
+}
+
+template <size_t SIZE>
+rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStream& stream, tCheapCopyPayload<SIZE>& payload)
+{
+  for (uint8_t & byte : payload.data)
+  {
+    stream >> byte;
+  }
+  return stream;
+}
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+/*! Numbers of connected input ports to benchmark */
+static const size_t cFAN_OUTS[] = { 1, 4, 16 };
+
+/*! Numbers of output ports to publish values of via tPublishBatch */
+static const size_t cBATCH_SIZES[] = { 4, 32, 256 };
+
+/*! Payload sizes (in bytes) to benchmark with standard ports */
+static const size_t cPAYLOAD_SIZES[] = { 16, 256, 4096, 65536 };
+
+/*! Data types of cheaply-copied payloads (sizes 16, 64 and 256 bytes - 256 is the maximum size of cheaply-copied types) */
+static rrlib::rtti::tDataType<tCheapCopyPayload<16>> cINIT_DATA_TYPE_PAYLOAD_16("CheapCopyPayload16");
+static rrlib::rtti::tDataType<tCheapCopyPayload<64>> cINIT_DATA_TYPE_PAYLOAD_64("CheapCopyPayload64");
+static rrlib::rtti::tDataType<tCheapCopyPayload<256>> cINIT_DATA_TYPE_PAYLOAD_256("CheapCopyPayload256");
+
+/*! Numbers of concurrent reader threads to benchmark */
+#ifndef RRLIB_SINGLE_THREADED
+static const size_t cREADER_THREADS[] = { 0, 1, 4 };
+#else
+static const size_t cREADER_THREADS[] = { 0 };
+#endif
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+/*! Number of iterations per measurement */
+static size_t iterations = 100000;
+
+/*!
+ * Prints result of one measurement as CSV line
+ */
+static void PrintResult(const char* backend, const char* operation, size_t payload_bytes, size_t fan_out, size_t reader_threads, tClock::duration duration)
+{
+  double ns_per_operation = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / static_cast<double>(iterations);
+  std::cout << backend << "," << operation << "," << payload_bytes << "," << fan_out << "," << reader_threads << "," << iterations << "," << ns_per_operation << std::endl;
+}
+
+/*!
+ * Payload that is published in benchmark
+ * (specialized for std::vector and tCheapCopyPayload in order to vary payload size)
+ */
+template <typename T>
+struct tPayload
+{
+  static T Create(size_t size, int seed)
+  {
+    return static_cast<T>(seed);
+  }
+  static void Fill(T& buffer, size_t size, int seed)
+  {
+    buffer = static_cast<T>(seed);
+  }
+  static size_t Size(size_t size)
+  {
+    return sizeof(T);
+  }
+};
+
+template <typename T>
+struct tPayload<std::vector<T>>
+{
+  static std::vector<T> Create(size_t size, int seed)
+  {
+    return std::vector<T>(size / sizeof(T), static_cast<T>(seed));
+  }
+  static void Fill(std::vector<T>& buffer, size_t size, int seed)
+  {
+    buffer.assign(size / sizeof(T), static_cast<T>(seed));
+  }
+  static size_t Size(size_t size)
+  {
+    return size;
+  }
+};
+
+template <size_t SIZE>
+struct tPayload<tCheapCopyPayload<SIZE>>
+{
+  static tCheapCopyPayload<SIZE> Create(size_t size, int seed)
+  {
+    tCheapCopyPayload<SIZE> result;
+    Fill(result, size, seed);
+    return result;
+  }
+  static void Fill(tCheapCopyPayload<SIZE>& buffer, size_t size, int seed)
+  {
+    buffer.data.fill(static_cast<uint8_t>(seed));
+  }
+  static size_t Size(size_t size)
+  {
+    return SIZE;
+  }
+};
+
+#ifndef RRLIB_SINGLE_THREADED
+
+/*!
+ * Thread that calls GetPointer() on input port until stopped
+ */
+template <typename T>
+class tPortReaderThread : public rrlib::thread::tThread
+{
+public:
+
+  tPortReaderThread(tInputPort<T>& port, std::atomic<bool>& stop) :
+    rrlib::thread::tThread("Port Reader"),
+    port(port),
+    stop(stop)
+  {}
+
+  virtual void Run() override
+  {
+    while (!stop.load(std::memory_order_relaxed))
+    {
+      tPortDataPointer<const T> pointer = port.GetPointer();
+      (void)pointer;
+    }
+  }
+
+private:
+
+  /*! Port to read values from */
+  tInputPort<T>& port;
+
+  /*! Set to stop thread */
+  std::atomic<bool>& stop;
+};
+
+/*!
+ * Thread that locks and releases reference counter until stopped
+ */
+template <typename TCounter>
+class tCounterReaderThread : public rrlib::thread::tThread
+{
+public:
+
+  tCounterReaderThread(TCounter& counter, int tag, std::atomic<bool>& stop) :
+    rrlib::thread::tThread("Counter Reader"),
+    counter(counter),
+    tag(tag),
+    stop(stop)
+  {}
+
+  virtual void Run() override
+  {
+    while (!stop.load(std::memory_order_relaxed))
+    {
+      if (counter.TryLock(1, tag))
+      {
+        counter.ReleaseLocks(1);
+      }
+    }
+  }
+
+private:
+
+  /*! Counter to lock */
+  TCounter& counter;
+
+  /*! Reuse tag of counter */
+  int tag;
+
+  /*! Set to stop thread */
+  std::atomic<bool>& stop;
+};
+
+/*!
+ * Stops and joins reader threads
+ */
+static void StopReaders(std::atomic<bool>& stop_readers, std::vector<std::shared_ptr<rrlib::thread::tThread>>& readers)
+{
+  stop_readers = true;
+  for (auto & reader : readers)
+  {
+    reader->Join();
+  }
+}
+
+#endif
+
+/*!
+ * Runs all measurements for one backend, payload size, fan-out and number of reader threads
+ *
+ * \param backend Name of backend to print
+ * \param payload_size Size of payload (only relevant for std::vector types)
+ * \param fan_out Number of input ports connected to output port
+ * \param reader_threads Number of threads that concurrently call GetPointer() on the input ports
+ */
+template <typename T>
+void Benchmark(const char* backend, size_t payload_size, size_t fan_out, size_t reader_threads)
+{
+  finroc::core::tFrameworkElement* parent = new finroc::core::tFrameworkElement(&finroc::core::tRuntimeEnvironment::GetInstance(), "Benchmark");
+  tOutputPort<T> output_port("Output Port", parent);
+  std::vector<std::unique_ptr<tInputPort<T>>> input_ports;
+  for (size_t i = 0; i < fan_out; i++)
+  {
+    input_ports.emplace_back(new tInputPort<T>("Input Port " + std::to_string(i), parent));
+    output_port.ConnectTo(*input_ports.back());
+  }
+  parent->Init();
+
+  const size_t payload_bytes = tPayload<T>::Size(payload_size);
+  const T value1 = tPayload<T>::Create(payload_size, 1);
+  const T value2 = tPayload<T>::Create(payload_size, 2);
+  output_port.Publish(value1);
+
+#ifndef RRLIB_SINGLE_THREADED
+  std::atomic<bool> stop_readers(false);
+  std::vector<std::shared_ptr<rrlib::thread::tThread>> readers;
+  for (size_t i = 0; i < reader_threads; i++)
+  {
+    tPortReaderThread<T>* reader = new tPortReaderThread<T>(*input_ports[i % fan_out], stop_readers);
+    readers.push_back(reader->GetSharedPtr());
+    reader->Start();
+  }
+#endif
+
+  // Publish latency: value is copied to buffer and forwarded to all input ports
+  tClock::time_point start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    output_port.Publish((i & 1) ? value1 : value2);
+  }
+  PrintResult(backend, "publish", payload_bytes, fan_out, reader_threads, tClock::now() - start);
+
+  // Publish latency with buffer obtained via GetUnusedBuffer() (zero-copy path)
+  start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    tPortDataPointer<T> buffer = output_port.GetUnusedBuffer();
+    tPayload<T>::Fill(*buffer, payload_size, (i & 1) ? 1 : 2);
+    output_port.Publish(buffer);
+  }
+  PrintResult(backend, "publish_unused_buffer", payload_bytes, fan_out, reader_threads, tClock::now() - start);
+
+  // Get latency (copies value)
+  T result = value1;
+  tInputPort<T>& input_port = *input_ports.front();
+  start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    input_port.Get(result);
+  }
+  PrintResult(backend, "get", payload_bytes, fan_out, reader_threads, tClock::now() - start);
+
+  // GetPointer latency (locks buffer)
+  start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    tPortDataPointer<const T> pointer = input_port.GetPointer();
+    (void)pointer;
+  }
+  PrintResult(backend, "get_pointer", payload_bytes, fan_out, reader_threads, tClock::now() - start);
+
+  // End-to-end throughput: publish and read value from every connected input port
+  start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    output_port.Publish((i & 1) ? value1 : value2);
+    for (auto & port : input_ports)
+    {
+      tPortDataPointer<const T> pointer = port->GetPointer();
+      (void)pointer;
+    }
+  }
+  PrintResult(backend, "publish_and_read_all", payload_bytes, fan_out, reader_threads, tClock::now() - start);
+
+#ifndef RRLIB_SINGLE_THREADED
+  StopReaders(stop_readers, readers);
+#endif
+  parent->ManagedDelete();
+}
+
+/*!
+ * Runs benchmark for all fan-outs and reader thread counts
+ */
+template <typename T>
+void BenchmarkAllConfigurations(const char* backend, size_t payload_size = 0)
+{
+  for (size_t fan_out : cFAN_OUTS)
+  {
+    for (size_t reader_threads : cREADER_THREADS)
+    {
+      Benchmark<T>(backend, payload_size, fan_out, reader_threads);
+    }
+  }
+}
+
+/*!
+ * Compares publishing the values of many output ports via tPublishBatch to calling Publish() on every port
+ *
+ * \param backend Name of backend to print
+ * \param port_count Number of output ports (each connected to one input port)
+ * \param frozen_topology Freeze topology of output ports? (so that batch can prefetch push destinations)
+ */
+template <typename T>
+void BenchmarkPublishBatch(const char* backend, size_t port_count, bool frozen_topology)
+{
+  finroc::core::tFrameworkElement* parent = new finroc::core::tFrameworkElement(&finroc::core::tRuntimeEnvironment::GetInstance(), "Benchmark");
+  std::vector<std::unique_ptr<tOutputPort<T>>> output_ports;
+  std::vector<std::unique_ptr<tInputPort<T>>> input_ports;
+  for (size_t i = 0; i < port_count; i++)
+  {
+    output_ports.emplace_back(new tOutputPort<T>("Output Port " + std::to_string(i), parent));
+    input_ports.emplace_back(new tInputPort<T>("Input Port " + std::to_string(i), parent));
+    output_ports.back()->ConnectTo(*input_ports.back());
+  }
+  parent->Init();
+  if (frozen_topology)
+  {
+    for (auto & port : output_ports)
+    {
+      port->GetWrapped()->SetTopologyFrozen(true);
+    }
+  }
+
+  const T value1 = tPayload<T>::Create(0, 1);
+  const T value2 = tPayload<T>::Create(0, 2);
+  const char* suffix = frozen_topology ? "_frozen" : "";
+
+  // Publish() on every port
+  tClock::time_point start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    for (auto & port : output_ports)
+    {
+      port->Publish((i & 1) ? value1 : value2);
+    }
+  }
+  PrintResult(backend, (std::string("publish_per_port") + suffix).c_str(), sizeof(T), port_count, 0, tClock::now() - start);
+
+  // Same values via batch
+  tPublishBatch batch(port_count);
+  start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    for (auto & port : output_ports)
+    {
+      batch.Add(*port, (i & 1) ? value1 : value2);
+    }
+    batch.Publish();
+  }
+  PrintResult(backend, (std::string("publish_batch") + suffix).c_str(), sizeof(T), port_count, 0, tClock::now() - start);
+
+  parent->ManagedDelete();
+}
+
+/*!
+ * Benchmarks operations on reference counter layout
+ * (typical publishing cycle: init with lock reservation, locks for readers, release of all locks)
+ *
+ * \param backend Name of backend to print
+ * \param reader_threads Number of threads that concurrently lock and release counter
+ */
+template <bool WIDE>
+void BenchmarkReferenceCounter(const char* backend, size_t reader_threads)
+{
+  typedef finroc::data_ports::common::tReferenceAndReuseCounter<WIDE> tCounter;
+  tCounter counter;
+  int tag = counter.Init(1);
+
+#ifndef RRLIB_SINGLE_THREADED
+  std::atomic<bool> stop_readers(false);
+  std::vector<std::shared_ptr<rrlib::thread::tThread>> readers;
+  for (size_t i = 0; i < reader_threads; i++)
+  {
+    tCounterReaderThread<tCounter>* reader = new tCounterReaderThread<tCounter>(counter, tag, stop_readers);
+    readers.push_back(reader->GetSharedPtr());
+    reader->Start();
+  }
+#endif
+
+  // Publishing cycle with lock reservation (lock for initial value is kept)
+  tClock::time_point start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    counter.AddLocks(1000);
+    counter.TryLock(1, tag);
+    counter.ReleaseLocks(1);
+    counter.ReleaseLocks(1000);
+  }
+  PrintResult(backend, "reserve_lock_release", 0, 1, reader_threads, tClock::now() - start);
+
+  // Lock and release of current value (e.g. GetPointer())
+  start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    if (counter.TryLock(1, tag))
+    {
+      counter.ReleaseLocks(1);
+    }
+  }
+  PrintResult(backend, "try_lock_release", 0, 1, reader_threads, tClock::now() - start);
+
+#ifndef RRLIB_SINGLE_THREADED
+  StopReaders(stop_readers, readers);
+#endif
+
+  // Reinitialization for reuse (buffer is not shared at this point)
+  start = tClock::now();
+  for (size_t i = 0; i < iterations; i++)
+  {
+    counter.Init(2);
+    counter.ReleaseLocks(2);
+  }
+  PrintResult(backend, "init_release", 0, 1, 0, tClock::now() - start);
+}
+
+int main(int argc, char** argv)
+{
+  if (argc > 1)
+  {
+    iterations = std::max(1, std::atoi(argv[1]));
+  }
+
+  std::cout << "backend,operation,payload_bytes,fan_out,reader_threads,iterations,ns_per_operation" << std::endl;
+
+#ifndef RRLIB_SINGLE_THREADED
+  BenchmarkAllConfigurations<int>("cheap_copy_global");
+  BenchmarkAllConfigurations<double>("cheap_copy_numeric_global");
+  {
+    tThreadLocalBufferManagement local_buffers;
+    BenchmarkAllConfigurations<int>("cheap_copy_thread_local");
+    BenchmarkAllConfigurations<double>("cheap_copy_numeric_thread_local");
+  }
+#else
+  BenchmarkAllConfigurations<int>("cheap_copy_single_threaded");
+  BenchmarkAllConfigurations<double>("cheap_copy_numeric_single_threaded");
+#endif
+
+  BenchmarkAllConfigurations<tCheapCopyPayload<16>>("cheap_copy_payload");
+  BenchmarkAllConfigurations<tCheapCopyPayload<64>>("cheap_copy_payload");
+  BenchmarkAllConfigurations<tCheapCopyPayload<256>>("cheap_copy_payload");
+
+  for (size_t payload_size : cPAYLOAD_SIZES)
+  {
+    BenchmarkAllConfigurations<std::vector<uint8_t>>("standard", payload_size);
+  }
+
+  for (size_t port_count : cBATCH_SIZES)
+  {
+    BenchmarkPublishBatch<int>("cheap_copy_global", port_count, false);
+    BenchmarkPublishBatch<int>("cheap_copy_global", port_count, true);
+  }
+
+  for (size_t reader_threads : cREADER_THREADS)
+  {
+    BenchmarkReferenceCounter<false>("reference_counter_32", reader_threads);
+    BenchmarkReferenceCounter<true>("reference_counter_64", reader_threads);
+  }
+  return 0;
+}
@@ -33,17 +33,28 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <atomic>
+#include <cstdint>
 #include "core/tRuntimeEnvironment.h"
+#include "rrlib/thread/tThread.h"
 #include "rrlib/util/tUnitTestSuite.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/data_ports/tAsyncPull.h"
+#include "plugins/data_ports/tBulkConnect.h"
+#include "plugins/data_ports/tConnectionTransaction.h"
 #include "plugins/data_ports/tInputPort.h"
+#include "plugins/data_ports/tLatestValueListener.h"
 #include "plugins/data_ports/tOutputPort.h"
 #include "plugins/data_ports/tProxyPort.h"
 #include "plugins/data_ports/tThreadLocalBufferManagement.h"
 #include "plugins/data_ports/tPortPack.h"
+#include "plugins/data_ports/tPublishBatch.h"
+#include "plugins/data_ports/common/tReferenceAndReuseCounter.h"
+#include "plugins/data_ports/common/tStartupProfiler.h"
+#include "plugins/data_ports/numeric/tTypedNumber.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -175,6 +186,140 @@ void TestPortQueues(const T& value1, const T& value2, const T& value3)
 
 
 
+template <typename T>
+void TestBoundedPortQueues(const T& value1, const T& value2, const T& value3)
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestBoundedPortQueues");
+
+  tOutputPort<T> output_port1("Output Port 1", parent);
+  tOutputPort<T> output_port2("Output Port 2", parent);
+  tInputPort<T> input_port_ring_buffer("Input Port Ring Buffer", parent, tQueueSettings(false, 2, true));
+  tInputPort<T> input_port_concurrent("Input Port Concurrent", parent, tQueueSettings(false, 2, false));
+  output_port1.ConnectTo(input_port_ring_buffer);
+  output_port1.ConnectTo(input_port_concurrent);
+  parent->Init();
+
+  // Single source: oldest value is discarded when queue is full
+  output_port1.Publish(value1);
+  output_port1.Publish(value2);
+  output_port1.Publish(value3);
+  for (tInputPort<T>* port : { &input_port_ring_buffer, &input_port_concurrent })
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(value2, *port->Dequeue());
+    RRLIB_UNIT_TESTS_EQUALITY(value3, *port->Dequeue());
+    RRLIB_UNIT_TESTS_ASSERT(!port->Dequeue());
+  }
+
+  // Multiple sources
+  output_port2.ConnectTo(input_port_ring_buffer);
+  output_port1.Publish(value1);
+  output_port2.Publish(value2);
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port_ring_buffer.Dequeue());
+  RRLIB_UNIT_TESTS_EQUALITY(value2, *input_port_ring_buffer.Dequeue());
+  RRLIB_UNIT_TESTS_ASSERT(!input_port_ring_buffer.Dequeue());
+
+  // Values remain in order when number of sources decreases
+  output_port2.Publish(value1);
+  output_port2.DisconnectAll();
+  output_port1.Publish(value2);
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port_ring_buffer.Dequeue());
+  RRLIB_UNIT_TESTS_EQUALITY(value2, *input_port_ring_buffer.Dequeue());
+  RRLIB_UNIT_TESTS_ASSERT(!input_port_ring_buffer.Dequeue());
+
+  parent->ManagedDelete();
+}
+
+#ifndef RRLIB_SINGLE_THREADED
+
+/*! Thread that publishes the values 1 to 'count' via output port */
+class tPublishThread : public rrlib::thread::tThread
+{
+public:
+
+  tPublishThread(tOutputPort<int>& output_port, int count) :
+    rrlib::thread::tThread("Publish Thread"),
+    output_port(output_port),
+    count(count),
+    finished(false)
+  {}
+
+  virtual void Run() override
+  {
+    for (int i = 1; i <= count; i++)
+    {
+      output_port.Publish(i);
+    }
+    finished = true;
+  }
+
+  /*! Have all values been published? */
+  bool Finished() const
+  {
+    return finished;
+  }
+
+private:
+
+  /*! Port to publish values with */
+  tOutputPort<int>& output_port;
+
+  /*! Number of values to publish */
+  int count;
+
+  /*! Set when all values have been published */
+  std::atomic<bool> finished;
+};
+
+void TestConcurrentBoundedPortQueue()
+{
+  const int cMAX_QUEUE_LENGTH = 8;
+  const int cPUBLISHED_VALUES = 100000;
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestConcurrentBoundedPortQueue");
+
+  tOutputPort<int> output_port1("Output Port 1", parent);
+  tOutputPort<int> output_port2("Output Port 2", parent);
+  tInputPort<int> input_port("Input Port", parent, tQueueSettings(false, cMAX_QUEUE_LENGTH, true));
+  output_port1.ConnectTo(input_port);
+  parent->Init();
+
+  // Values must be dequeued in order while ring buffer and concurrent queue are switched (by changing number of sources)
+  tPublishThread* thread = new tPublishThread(output_port1, cPUBLISHED_VALUES);
+  std::shared_ptr<rrlib::thread::tThread> thread_pointer = thread->GetSharedPtr();
+  thread->Start();
+  int last_value = 0;
+  for (int i = 0; !thread->Finished(); i++)
+  {
+    if (i % 2)
+    {
+      output_port2.DisconnectAll();
+    }
+    else
+    {
+      output_port2.ConnectTo(input_port);
+    }
+    for (auto value = input_port.Dequeue(); value; value = input_port.Dequeue())
+    {
+      RRLIB_UNIT_TESTS_ASSERT(*value > last_value);
+      last_value = *value;
+    }
+  }
+  thread->Join();
+
+  int remaining_values = 0;
+  for (auto value = input_port.Dequeue(); value; value = input_port.Dequeue())
+  {
+    RRLIB_UNIT_TESTS_ASSERT(*value > last_value);
+    last_value = *value;
+    remaining_values++;
+  }
+  RRLIB_UNIT_TESTS_ASSERT(remaining_values <= cMAX_QUEUE_LENGTH);
+  RRLIB_UNIT_TESTS_EQUALITY(cPUBLISHED_VALUES, last_value);
+
+  parent->ManagedDelete();
+}
+
+#endif
+
 template <typename T>
 void TestPortListeners(const T& publish_value)
 {
@@ -234,6 +379,75 @@ void TestPortListeners(const T& publish_value)
   output_port.Publish(publish_value);
 
   RRLIB_UNIT_TESTS_ASSERT(listener.value1 == publish_value && listener.value2 == publish_value && listener.calls == 6);
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(6), input_port.GetWrapped()->GetPortListeners()->Size());
+
+  parent->ManagedDelete();
+}
+
+template <typename T>
+void TestDeferredPortListeners(const std::vector<T>& values)
+{
+  class tListener
+  {
+  public:
+    void OnPortChange(tPortDataPointer<const T>& value, tChangeContext& change_context)
+    {
+      this->values.push_back(*value);
+    }
+
+    std::vector<T> values;
+  };
+
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestDeferredPortListeners");
+  tDeferredListenerDispatcher dispatcher;
+  tListener latest_value_listener, queueing_listener;
+
+  tOutputPort<T> output_port("Output Port", parent);
+  tInputPort<T> input_port("Input Port", parent);
+  output_port.ConnectTo(input_port);
+  input_port.AddPortListenerDeferred(latest_value_listener, dispatcher);
+  input_port.AddPortListenerDeferred(queueing_listener, dispatcher, values.size());
+  parent->Init();
+
+  for (const T & value : values)
+  {
+    output_port.Publish(value);
+  }
+
+  // Nothing is delivered before sync point
+  RRLIB_UNIT_TESTS_ASSERT(latest_value_listener.values.empty() && queueing_listener.values.empty());
+  RRLIB_UNIT_TESTS_EQUALITY(values.size() + 1, dispatcher.ProcessEvents());
+  RRLIB_UNIT_TESTS_ASSERT(latest_value_listener.values.size() == 1 && latest_value_listener.values[0] == values.back());
+  RRLIB_UNIT_TESTS_ASSERT(queueing_listener.values == values);
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), dispatcher.ProcessEvents());
+
+  parent->ManagedDelete();
+}
+
+template <typename T>
+void TestLatestValueListener(const T& value1, const T& value2)
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestLatestValueListener");
+
+  tOutputPort<T> output_port("Output Port", parent);
+  tInputPort<T> input_port("Input Port", parent);
+  output_port.ConnectTo(input_port);
+  tLatestValueListener<T> listener(input_port);
+  parent->Init();
+  listener.GetLatest();
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(0), listener.PendingChanges());
+
+  output_port.Publish(value1);
+  output_port.Publish(value2);
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(2), listener.PendingChanges());
+  RRLIB_UNIT_TESTS_EQUALITY(value2, *listener.GetLatest());
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(0), listener.PendingChanges());
+
+  output_port.Publish(value1);
+  T value;
+  listener.GetLatest(value);
+  RRLIB_UNIT_TESTS_EQUALITY(value1, value);
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<uint64_t>(0), listener.PendingChanges());
 
   parent->ManagedDelete();
 }
@@ -364,6 +578,852 @@ void TestGenericPorts(T value_to_publish, T another_value)
   parent->ManagedDelete();
 }
 
+void TestPublishBatch()
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestPublishBatch");
+
+  tOutputPort<int> output_port_int("Output Port int", parent);
+  tOutputPort<double> output_port_double("Output Port double", parent);
+  tOutputPort<std::string> output_port_string("Output Port string", parent);
+  tInputPort<int> input_port_int("Input Port int", parent);
+  tInputPort<double> input_port_double("Input Port double", parent);
+  tInputPort<std::string> input_port_string("Input Port string", parent);
+  output_port_int.ConnectTo(input_port_int);
+  output_port_double.ConnectTo(input_port_double);
+  output_port_string.ConnectTo(input_port_string);
+  parent->Init();
+
+  tPublishBatch batch(3);
+  for (int i = 1; i <= 3; i++)
+  {
+    batch.Add(output_port_int, i);
+    batch.Add(output_port_double, i * 0.5);
+    batch.Add(output_port_string, std::string("Test") + std::to_string(i));
+    batch.Publish();
+    RRLIB_UNIT_TESTS_ASSERT(batch.Empty());
+    RRLIB_UNIT_TESTS_EQUALITY(i, input_port_int.Get());
+    RRLIB_UNIT_TESTS_EQUALITY(i * 0.5, input_port_double.Get());
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("Test") + std::to_string(i), *input_port_string.GetPointer());
+  }
+
+  // Cleared batches do not publish anything
+  batch.Add(output_port_int, 42);
+  batch.Add(output_port_string, std::string("Discarded"));
+  batch.Clear();
+  batch.Publish();
+  RRLIB_UNIT_TESTS_EQUALITY(3, input_port_int.Get());
+  RRLIB_UNIT_TESTS_EQUALITY(std::string("Test3"), *input_port_string.GetPointer());
+
+  parent->ManagedDelete();
+}
+
+#ifndef RRLIB_SINGLE_THREADED
+
+/*! Thread that increments counter of tPortStatistics object */
+class tIncrementThread : public rrlib::thread::tThread
+{
+public:
+
+  tIncrementThread(common::tPortStatistics& statistics, int count) :
+    rrlib::thread::tThread("Increment Thread"),
+    statistics(statistics),
+    count(count)
+  {}
+
+  virtual void Run() override
+  {
+    for (int i = 0; i < count; i++)
+    {
+      statistics.Increment(common::tPortCounter::RECEIVE);
+    }
+  }
+
+private:
+
+  /*! Statistics to increment counter of */
+  common::tPortStatistics& statistics;
+
+  /*! Number of increments */
+  int count;
+};
+
+#endif
+
+void TestPortStatistics()
+{
+  // Counters (independent of data_ports::cCOLLECT_PORT_STATISTICS)
+  std::unique_ptr<common::tPortStatistics> statistics(new common::tPortStatistics());
+  RRLIB_UNIT_TESTS_ASSERT(reinterpret_cast<uintptr_t>(statistics.get()) % common::tPortStatistics::cCACHE_LINE_SIZE == 0);
+  statistics->Increment(common::tPortCounter::PUBLISH, 2);
+  RRLIB_UNIT_TESTS_ASSERT(statistics->GetSnapshot().Get(common::tPortCounter::PUBLISH) == 2);
+#ifndef RRLIB_SINGLE_THREADED
+  const int cTHREADS = common::tPortStatistics::cSHARDS + 2;
+  const int cINCREMENTS = 10000;
+  std::vector<std::shared_ptr<rrlib::thread::tThread>> threads;
+  for (int i = 0; i < cTHREADS; i++)
+  {
+    tIncrementThread* thread = new tIncrementThread(*statistics, cINCREMENTS);
+    threads.push_back(thread->GetSharedPtr());
+    thread->Start();
+  }
+  for (auto & thread : threads)
+  {
+    thread->Join();
+  }
+  RRLIB_UNIT_TESTS_ASSERT(statistics->GetSnapshot().Get(common::tPortCounter::RECEIVE) == static_cast<uint64_t>(cTHREADS * cINCREMENTS));
+#endif
+  statistics->Reset();
+  RRLIB_UNIT_TESTS_ASSERT(statistics->GetSnapshot().Get(common::tPortCounter::PUBLISH) == 0);
+  RRLIB_UNIT_TESTS_ASSERT(statistics->GetSnapshot().Get(common::tPortCounter::RECEIVE) == 0);
+
+  // Port counters (only collected if data_ports::cCOLLECT_PORT_STATISTICS is set)
+  if (!cCOLLECT_PORT_STATISTICS)
+  {
+    return;
+  }
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestPortStatistics");
+
+  tOutputPort<int> output_port("Output Port", parent, tBounds<int>(0, 2, tOutOfBoundsAction::DISCARD));
+  tInputPort<int> input_port("Input Port", parent, tQueueSettings(false, 2));
+  output_port.ConnectTo(input_port);
+  parent->Init();
+  output_port.GetWrapped()->ResetStatistics();
+  input_port.GetWrapped()->ResetStatistics();
+
+  output_port.Publish(1);
+  output_port.Publish(2);
+  output_port.Publish(3);
+  output_port.Publish(0);
+  RRLIB_UNIT_TESTS_ASSERT(output_port.GetWrapped()->GetStatistics().Get(common::tPortCounter::PUBLISH) == 3);
+  RRLIB_UNIT_TESTS_ASSERT(output_port.GetWrapped()->GetStatistics().Get(common::tPortCounter::DROPPED_BY_BOUNDS) == 1);
+  RRLIB_UNIT_TESTS_ASSERT(input_port.GetWrapped()->GetStatistics().Get(common::tPortCounter::RECEIVE) == 3);
+  RRLIB_UNIT_TESTS_ASSERT(input_port.GetWrapped()->GetStatistics().Get(common::tPortCounter::QUEUE_OVERFLOW) == 1);
+
+  parent->ManagedDelete();
+}
+
+template <typename T>
+void TestFrozenTopology(const T& value1, const T& value2)
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestFrozenTopology");
+
+  tOutputPort<T> output_port("Output Port", parent);
+  tProxyPort<T, true> proxy_port("Proxy Port", parent);
+  tInputPort<T> input_port1("Input Port 1", parent);
+  tInputPort<T> input_port2("Input Port 2", parent);
+  tInputPort<T> input_port_queue("Input Port Queue", parent, tQueueSettings(false, 2));
+  tOutputPort<T> other_output_port("Other Output Port", parent);
+  tInputPort<T> other_input_port("Other Input Port", parent);
+  output_port.ConnectTo(proxy_port);
+  proxy_port.ConnectTo(input_port1);
+  parent->Init();
+  output_port.GetWrapped()->SetTopologyFrozen(true);
+  RRLIB_UNIT_TESTS_ASSERT(output_port.GetWrapped()->GetPushPlan() && output_port.GetWrapped()->GetPushPlan()->size() == 2);
+  RRLIB_UNIT_TESTS_EQUALITY(3, output_port.GetWrapped()->GetPushPlan()->lock_count);
+
+  output_port.Publish(value1);
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *proxy_port.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port1.GetPointer());
+
+  // Connecting ports rebuilds push plan
+  proxy_port.ConnectTo(input_port2);
+  RRLIB_UNIT_TESTS_ASSERT(output_port.GetWrapped()->GetPushPlan()->size() == 3);
+  RRLIB_UNIT_TESTS_EQUALITY(4, output_port.GetWrapped()->GetPushPlan()->lock_count);
+  output_port.Publish(value2);
+  RRLIB_UNIT_TESTS_EQUALITY(value2, *input_port1.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(value2, *input_port2.GetPointer());
+
+  // Changes in unrelated parts of the port graph do not rebuild push plan
+  const common::tAbstractDataPort::tPushPlan* push_plan = output_port.GetWrapped()->GetPushPlan();
+  other_output_port.ConnectTo(other_input_port);
+  other_input_port.SetPushStrategy(false);
+  RRLIB_UNIT_TESTS_ASSERT(push_plan == output_port.GetWrapped()->GetPushPlan());
+
+  // Listeners are included in lock count of push plan
+  struct tListener
+  {
+    void OnPortChange(tPortDataPointer<const T>& value, tChangeContext& change_context)
+    {
+      this->value = *value;
+    }
+    T value;
+  };
+  tListener listener;
+  input_port2.AddPortListenerForPointer(listener);
+  RRLIB_UNIT_TESTS_EQUALITY(5, output_port.GetWrapped()->GetPushPlan()->lock_count);
+  output_port.Publish(value1);
+  RRLIB_UNIT_TESTS_EQUALITY(value1, listener.value);
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port2.GetPointer());
+
+  // Queued destinations require an additional lock for enqueueing
+  proxy_port.ConnectTo(input_port_queue);
+  RRLIB_UNIT_TESTS_EQUALITY(7, output_port.GetWrapped()->GetPushPlan()->lock_count);
+  for (int i = 0; i < 20; i++)
+  {
+    output_port.Publish(i % 2 ? value1 : value2);
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(value2, *input_port_queue.Dequeue());
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port_queue.Dequeue());
+  RRLIB_UNIT_TESTS_ASSERT(!input_port_queue.Dequeue());
+
+  // Buffers are released (so publishing does not need to allocate any further buffers)
+  common::tAllocationMonitor::SetPolicy(common::tAllocationPolicy::COUNT);
+  common::tAllocationMonitor::ResetCounts();
+  common::tAllocationMonitor::SetSystemStarted(true);
+  for (int i = 0; i < 20; i++)
+  {
+    output_port.Publish(value1);
+    RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port_queue.Dequeue());
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), common::tAllocationMonitor::GetAllocationCount(common::tAllocationSite::PORT_BUFFER));
+  common::tAllocationMonitor::SetSystemStarted(false);
+  common::tAllocationMonitor::SetPolicy(common::tAllocationPolicy::LOG);
+
+  output_port.GetWrapped()->SetTopologyFrozen(false);
+  RRLIB_UNIT_TESTS_ASSERT(!output_port.GetWrapped()->GetPushPlan());
+  parent->ManagedDelete();
+}
+
+template <typename T>
+void TestPublishLockCount(const T& value1, const T& value2)
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestPublishLockCount");
+
+  tOutputPort<T> output_port("Output Port", parent);
+  tInputPort<T> input_port1("Input Port 1", parent);
+  tInputPort<T> input_port2("Input Port 2", parent);
+  tProxyPort<T, true> proxy_port("Proxy Port", parent);
+  std::vector<std::unique_ptr<tInputPort<T>>> forwarded_ports;
+  for (int i = 0; i < 8; i++)
+  {
+    forwarded_ports.emplace_back(new tInputPort<T>("Forwarded Port " + std::to_string(i), parent));
+  }
+  parent->Init();
+  common::tAbstractDataPort& output = *output_port.GetWrapped();
+  RRLIB_UNIT_TESTS_EQUALITY(0u, output.GetPushDestinationCount());
+  const int unconnected_lock_count = output.GetPublishLockCount(NULL);
+  RRLIB_UNIT_TESTS_EQUALITY(2, unconnected_lock_count);
+
+  // Reservation is derived from number of push destinations
+  output_port.ConnectTo(input_port1);
+  output_port.ConnectTo(input_port2);
+  RRLIB_UNIT_TESTS_EQUALITY(2u, output.GetPushDestinationCount());
+  RRLIB_UNIT_TESTS_EQUALITY(unconnected_lock_count + 2 * common::tAbstractDataPort::cPUSH_DESTINATION_LOCKS, output.GetPublishLockCount(NULL));
+  output_port.Publish(value1);
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port1.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port2.GetPointer());
+
+  input_port2.SetPushStrategy(false);
+  RRLIB_UNIT_TESTS_EQUALITY(1u, output.GetPushDestinationCount());
+  input_port1.DisconnectAll();
+  RRLIB_UNIT_TESTS_EQUALITY(0u, output.GetPushDestinationCount());
+  input_port2.DisconnectAll();
+  RRLIB_UNIT_TESTS_EQUALITY(0u, output.GetPushDestinationCount());
+  RRLIB_UNIT_TESTS_EQUALITY(unconnected_lock_count, output.GetPublishLockCount(NULL));
+
+  // Publishing operations add locks if values are forwarded to more ports than reserved for
+  output_port.ConnectTo(proxy_port);
+  for (auto & port : forwarded_ports)
+  {
+    proxy_port.ConnectTo(*port);
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(1u, output.GetPushDestinationCount());
+  for (int i = 0; i < 10; i++)
+  {
+    const T& value = (i % 2) ? value1 : value2;
+    output_port.Publish(value);
+    for (auto & port : forwarded_ports)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY(value, *port->GetPointer());
+    }
+  }
+
+  parent->ManagedDelete();
+}
+
+template <typename T>
+void TestBulkConnect(const T& value1)
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestBulkConnect");
+
+  tOutputPort<T> output_port("Output Port", parent);
+  tInputPort<T> input_port1("Input Port 1", parent);
+  tInputPort<T> input_port2("Input Port 2", parent);
+  tInputPort<T> input_port3("Input Port 3", parent);
+  input_port3.SetPushStrategy(false);
+  parent->Init();
+  output_port.GetWrapped()->SetTopologyFrozen(true);
+  output_port.Publish(value1);
+
+  // Strategies are propagated and initial pushes are performed when scope is left
+  {
+    tBulkConnect bulk_connect;
+    output_port.ConnectTo(input_port1);
+    output_port.ConnectTo(input_port2);
+    output_port.ConnectTo(input_port3);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<int16_t>(-1), output_port.GetWrapped()->GetStrategy());
+    RRLIB_UNIT_TESTS_EQUALITY(T(), *input_port1.GetPointer());
+    RRLIB_UNIT_TESTS_ASSERT(!output_port.GetWrapped()->GetPushPlan());
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<int16_t>(1), output_port.GetWrapped()->GetStrategy());
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port1.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port2.GetPointer());
+  RRLIB_UNIT_TESTS_ASSERT(output_port.GetWrapped()->GetPushPlan() && output_port.GetWrapped()->GetPushPlan()->size() == 2);
+
+  // Strategy of source follows destination strategies
+  input_port1.SetPushStrategy(false);
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<int16_t>(1), output_port.GetWrapped()->GetStrategy());
+  input_port2.SetPushStrategy(false);
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<int16_t>(0), output_port.GetWrapped()->GetStrategy());
+  input_port1.SetPushStrategy(true);
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<int16_t>(1), output_port.GetWrapped()->GetStrategy());
+  {
+    tBulkConnect bulk_connect;
+    output_port.DisconnectAll();
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<int16_t>(-1), output_port.GetWrapped()->GetStrategy());
+  RRLIB_UNIT_TESTS_ASSERT(output_port.GetWrapped()->GetPushPlan() && output_port.GetWrapped()->GetPushPlan()->empty());
+
+  parent->ManagedDelete();
+}
+
+template <typename T>
+void TestConnectionTransaction(const T& value1)
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestConnectionTransaction");
+
+  tOutputPort<T> output_port("Output Port", parent);
+  tInputPort<T> input_port1("Input Port 1", parent);
+  tInputPort<T> input_port2("Input Port 2", parent);
+  parent->Init();
+  output_port.Publish(value1);
+
+  // Initial pushes are collected - duplicates (second push to input port 1) are removed
+  tConnectionTransaction transaction;
+  output_port.ConnectTo(input_port1);
+  output_port.ConnectTo(input_port2);
+  input_port1.SetPushStrategy(false);
+  input_port1.SetPushStrategy(true);
+  RRLIB_UNIT_TESTS_EQUALITY(T(), *input_port1.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(2), transaction.Commit(2));
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port1.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port2.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), transaction.Commit());
+
+  parent->ManagedDelete();
+}
+
+template <typename T>
+void TestPullCache(const T& value1, const T& value2)
+{
+  class tHandler : public tPullRequestHandler<T>
+  {
+  public:
+    virtual tPortDataPointer<const T> OnPullRequest(tOutputPort<T>& origin) override
+    {
+      this->calls++;
+      tPortDataPointer<T> buffer = origin.GetUnusedBuffer();
+      *buffer = this->calls == 1 ? value1 : value2;
+      return std::move(buffer);
+    }
+
+    tHandler(const T& value1, const T& value2) : value1(value1), value2(value2), calls(0) {}
+
+    T value1, value2;
+    int calls;
+  };
+
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestPullCache");
+  tHandler handler(value1, value2);
+
+  tOutputPort<T> output_port("Output Port", parent);
+  tInputPort<T> input_port1("Input Port 1", parent);
+  tInputPort<T> input_port2("Input Port 2", parent);
+  output_port.SetPullRequestHandler(&handler);
+  output_port.GetWrapped()->SetPullCacheWindow(std::chrono::hours(1));
+  output_port.ConnectTo(input_port1);
+  output_port.ConnectTo(input_port2);
+  input_port1.SetPushStrategy(false);
+  input_port2.SetPushStrategy(false);
+  parent->Init();
+
+  // Pulls within freshness window do not call handler again
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port1.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(value1, *input_port2.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(1, handler.calls);
+
+  output_port.GetWrapped()->GetPullCache()->Invalidate();
+  RRLIB_UNIT_TESTS_EQUALITY(value2, *input_port2.GetPointer());
+  RRLIB_UNIT_TESTS_EQUALITY(2, handler.calls);
+
+  parent->ManagedDelete();
+}
+
+template <typename T>
+void TestAsyncPull(const T& value1, const T& value2)
+{
+  class tHandler : public tPullRequestHandler<T>
+  {
+  public:
+    virtual tPortDataPointer<const T> OnPullRequest(tOutputPort<T>& origin) override
+    {
+      int call = ++this->calls;
+      if (throw_exception)
+      {
+        throw std::runtime_error("Pull failed");
+      }
+      tPortDataPointer<T> buffer = origin.GetUnusedBuffer();
+      *buffer = call == 1 ? value1 : value2;
+      return std::move(buffer);
+    }
+
+    tHandler(const T& value1, const T& value2) : value1(value1), value2(value2), calls(0), throw_exception(false) {}
+
+    T value1, value2;
+    std::atomic<int> calls;
+    std::atomic<bool> throw_exception;
+  };
+
+  api::tAsyncPullExecutor::GetInstance().StartWorkerThreads();
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestAsyncPull");
+  tHandler handler(value1, value2);
+
+  tOutputPort<T> output_port("Output Port", parent);
+  tInputPort<T> input_port("Input Port", parent);
+  output_port.SetPullRequestHandler(&handler);
+  output_port.ConnectTo(input_port);
+  input_port.SetPushStrategy(false);
+  parent->Init();
+
+  // Concurrent requests share a pending pull operation
+  tAsyncPull<tPort<T>> pull1 = input_port.GetAsync();
+  tAsyncPull<tPort<T>> pull2 = input_port.GetAsync();
+  T result1 = *pull1.GetPointer(std::chrono::seconds(5));
+  RRLIB_UNIT_TESTS_ASSERT(pull1.Ready() && pull2.Wait(std::chrono::seconds(5)));
+  RRLIB_UNIT_TESTS_ASSERT(handler.calls.load() >= 1 && handler.calls.load() <= 2);
+  RRLIB_UNIT_TESTS_ASSERT(result1 == value1 || result1 == value2);
+
+  // New request after completion starts new pull operation
+  int calls = handler.calls.load();
+  tGenericPort generic_port = tGenericPort::Wrap(*input_port.GetWrapped());
+  auto pull3 = generic_port.GetPointerAsync();
+  RRLIB_UNIT_TESTS_ASSERT(pull3.Wait(std::chrono::seconds(5)));
+  RRLIB_UNIT_TESTS_EQUALITY(calls + 1, handler.calls.load());
+  RRLIB_UNIT_TESTS_EQUALITY(value2, pull3.GetPointer()->GetData<T>());
+
+  // Failed pull operation completes its future - and does not block subsequent requests
+  handler.throw_exception = true;
+  tAsyncPull<tPort<T>> pull4 = input_port.GetAsync();
+  RRLIB_UNIT_TESTS_ASSERT(pull4.Wait(std::chrono::seconds(5)));
+  handler.throw_exception = false;
+  tAsyncPull<tPort<T>> pull5 = input_port.GetAsync();
+  RRLIB_UNIT_TESTS_ASSERT(pull5.Wait(std::chrono::seconds(5)));
+  RRLIB_UNIT_TESTS_EQUALITY(value2, *pull5.GetPointer());
+
+  parent->ManagedDelete();
+  api::tAsyncPullExecutor::GetInstance().StopWorkerThreads();
+}
+
+void TestBufferPoolPrewarming()
+{
+#ifndef RRLIB_SINGLE_THREADED
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestBufferPoolPrewarming");
+
+  tOutputPort<int> output_port("Output Port", parent);
+  tInputPort<int> input_port1("Input Port 1", parent);
+  tInputPort<int> input_port2("Input Port 2", parent, tQueueSettings(false, 5));
+  output_port.ConnectTo(input_port1);
+  output_port.ConnectTo(input_port2);
+  parent->Init();
+
+  optimized::tGlobalBufferPools& pools = optimized::tGlobalBufferPools::Instance();
+  uint32_t type_index = output_port.GetWrapped()->GetCheaplyCopyableTypeIndex();
+  RRLIB_UNIT_TESTS_ASSERT(optimized::GetConnectionCount(type_index) >= 2 && optimized::GetQueueCapacity(type_index) >= 5);
+  pools.PrewarmPools();
+  const optimized::tBufferPoolSizingPolicy& policy = optimized::GetBufferPoolSizingPolicy(false);
+  size_t expected_size = policy.GetPoolSize(type_index, optimized::GetPortCount(type_index), optimized::GetConnectionCount(type_index), optimized::GetQueueCapacity(type_index));
+  RRLIB_UNIT_TESTS_ASSERT(pools.GetPoolStatistics(type_index).allocated_buffers >= expected_size);
+
+  // No buffers need to be allocated when publishing after pools have been prewarmed
+  size_t misses = pools.GetPoolStatistics(type_index).misses;
+  for (int i = 0; i < 10; i++)
+  {
+    output_port.Publish(i);
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(misses, pools.GetPoolStatistics(type_index).misses);
+  RRLIB_UNIT_TESTS_EQUALITY(9, input_port1.Get());
+
+  // Publishing thread uses pools of its NUMA node
+  uint32_t numa_node = optimized::tGlobalBufferPools::GetCurrentNumaNode();
+  RRLIB_UNIT_TESTS_ASSERT(numa_node < optimized::tGlobalBufferPools::GetNumaNodeCount());
+  RRLIB_UNIT_TESTS_ASSERT(&pools == optimized::tGlobalBufferPools::GetInstanceForNumaNode(numa_node) && pools.GetNumaNode() == numa_node);
+
+  // Pools of all NUMA nodes can be created and prewarmed at startup
+  optimized::tGlobalBufferPools::PrewarmAllNumaNodes();
+  for (uint32_t i = 0; i < optimized::tGlobalBufferPools::GetNumaNodeCount(); i++)
+  {
+    optimized::tGlobalBufferPools* node_pools = optimized::tGlobalBufferPools::GetInstanceForNumaNode(i);
+    RRLIB_UNIT_TESTS_ASSERT(node_pools && node_pools->GetPoolStatistics(type_index).allocated_buffers >= expected_size);
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(numa_node, optimized::tGlobalBufferPools::GetCurrentNumaNode());
+
+  parent->ManagedDelete();
+#endif
+}
+
+void TestAllocationMonitor()
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestAllocationMonitor");
+
+  tOutputPort<std::string> output_port("Output Port", parent);
+  tInputPort<std::string> input_port("Input Port", parent, tQueueSettings(false, 4));
+  output_port.ConnectTo(input_port);
+  parent->Init();
+  output_port.GetWrapped()->ProvisionBuffers(10);
+
+  common::tAllocationMonitor::SetPolicy(common::tAllocationPolicy::COUNT);
+  common::tAllocationMonitor::ResetCounts();
+  common::tAllocationMonitor::SetSystemStarted(true);
+  for (int i = 0; i < 10; i++)
+  {
+    output_port.Publish(std::to_string(i));
+  }
+  RRLIB_UNIT_TESTS_ASSERT(common::tAllocationMonitor::GetTotalAllocationCount() == 0);
+
+  // Exhaust provisioned buffers
+  std::vector<tPortDataPointer<std::string>> buffers;
+  for (int i = 0; i < 11; i++)
+  {
+    buffers.push_back(output_port.GetUnusedBuffer());
+  }
+  RRLIB_UNIT_TESTS_ASSERT(common::tAllocationMonitor::GetAllocationCount(common::tAllocationSite::PORT_BUFFER) > 0);
+  buffers.clear();
+
+  common::tAllocationMonitor::SetSystemStarted(false);
+  common::tAllocationMonitor::SetPolicy(common::tAllocationPolicy::LOG);
+  parent->ManagedDelete();
+}
+
+void TestStartupProfiler()
+{
+  common::tStartupProfiler::Reset();
+  common::tStartupProfiler::SetEnabled(true);
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestStartupProfiler");
+  tOutputPort<int> output_port("Output Port", parent, 5);
+  tInputPort<int> input_port("Input Port", parent);
+  tOutputPort<std::string> string_output_port("String Output Port", parent);
+  parent->Init();
+  output_port.ConnectTo(input_port);
+  string_output_port.GetWrapped()->ProvisionBuffers(4);
+  common::tStartupProfiler::SetEnabled(false);
+
+  std::string summary = common::tStartupProfiler::GetSummary(100);
+  RRLIB_UNIT_TESTS_ASSERT(summary.find("strategy propagation") != std::string::npos);
+  RRLIB_UNIT_TESTS_ASSERT(summary.find(input_port.GetWrapped()->GetQualifiedName()) != std::string::npos);
+  RRLIB_UNIT_TESTS_ASSERT(summary.find(string_output_port.GetWrapped()->GetQualifiedName()) != std::string::npos);
+  RRLIB_UNIT_TESTS_EQUALITY(5, input_port.Get());
+
+  common::tStartupProfiler::Reset();
+  parent->ManagedDelete();
+}
+
+void TestDequeueAllInto()
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestDequeueAllInto");
+
+  tOutputPort<int> output_port("Output Port", parent);
+  tInputPort<int> input_port("Input Port", parent, tQueueSettings(true));
+  output_port.ConnectTo(input_port);
+  parent->Init();
+
+  for (int i = 0; i < 100; i++)
+  {
+    output_port.Publish(i);
+  }
+  std::vector<int> values;
+  std::vector<rrlib::time::tTimestamp> timestamps;
+  values.reserve(100);
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(100), input_port.DequeueAllInto(values, &timestamps));
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(100), timestamps.size());
+  for (int i = 0; i < 100; i++)
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(i, values[i]);
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), input_port.DequeueAllInto(values));
+
+  // Locks of buffers that are not popped are released in bulk
+  for (int i = 0; i < 20; i++)
+  {
+    output_port.Publish(i);
+  }
+  {
+    tPortBuffers<int> buffers = input_port.DequeueAll();
+    RRLIB_UNIT_TESTS_EQUALITY(0, buffers.PopFront());
+  }
+  output_port.Publish(42);
+  values.clear();
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(1), input_port.DequeueAllInto(values));
+  RRLIB_UNIT_TESTS_EQUALITY(42, values[0]);
+
+  parent->ManagedDelete();
+}
+
+void TestNumberConversion()
+{
+  // Bulk conversion handles runs of different number types
+  std::vector<numeric::tNumber> numbers = { numeric::tNumber(1), numeric::tNumber(2), numeric::tNumber(3.5), numeric::tNumber(4.5f), numeric::tNumber(5.5f), numeric::tNumber(6) };
+  std::vector<double> doubles;
+  numeric::tNumber::ConvertTo(numbers, doubles);
+  RRLIB_UNIT_TESTS_EQUALITY(numbers.size(), doubles.size());
+  for (size_t i = 0; i < numbers.size(); i++)
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(numbers[i].Value<double>(), doubles[i]);
+  }
+
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestNumberConversion");
+
+  // Dequeued numbers are converted in batches
+  tOutputPort<double> output_port("Output Port", parent);
+  tInputPort<int> input_port("Input Port", parent, tQueueSettings(true, 200));
+  output_port.ConnectTo(input_port);
+
+  // Typed numbers are stored natively
+  tOutputPort<numeric::tTypedNumber<double>> typed_output_port("Typed Output Port", parent);
+  tInputPort<numeric::tTypedNumber<double>> typed_input_port("Typed Input Port", parent);
+  typed_output_port.ConnectTo(typed_input_port);
+  parent->Init();
+
+  for (int i = 0; i < 150; i++)
+  {
+    output_port.Publish(i + 0.25);
+  }
+  std::vector<int> values;
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(150), input_port.DequeueAllInto(values));
+  for (int i = 0; i < 150; i++)
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(i, values[i]);
+  }
+
+  typed_output_port.Publish(numeric::tTypedNumber<double>(4.25));
+  RRLIB_UNIT_TESTS_EQUALITY(4.25, static_cast<double>(typed_input_port.Get()));
+
+  parent->ManagedDelete();
+}
+
+void TestThreadLocalBufferCache()
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestThreadLocalBufferCache");
+
+  tOutputPort<std::string> output_port("Output Port", parent);
+  tInputPort<std::string> input_port("Input Port", parent);
+  tInputPort<std::string> input_port_queue("Input Port Queue", parent, tQueueSettings(false, 5));
+  output_port.ConnectTo(input_port);
+  output_port.ConnectTo(input_port_queue);
+  parent->Init();
+
+  {
+    standard::tThreadLocalBufferCache cache(2, 4);
+    RRLIB_UNIT_TESTS_ASSERT(standard::tThreadLocalBufferCache::Get() == &cache);
+    for (int i = 0; i < 20; i++)
+    {
+      output_port.Publish(std::to_string(i));
+      RRLIB_UNIT_TESTS_EQUALITY(std::to_string(i), *input_port.GetPointer());
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("15"), *input_port_queue.Dequeue());
+  }
+  RRLIB_UNIT_TESTS_ASSERT(standard::tThreadLocalBufferCache::Get() == NULL);
+  output_port.Publish("after");
+  RRLIB_UNIT_TESTS_EQUALITY(std::string("after"), *input_port.GetPointer());
+
+  parent->ManagedDelete();
+}
+
+void TestEpochProtectedReads()
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestEpochProtectedReads");
+
+  tOutputPort<std::string> output_port("Output Port", parent);
+  tInputPort<std::string> input_port("Input Port", parent);
+  output_port.ConnectTo(input_port);
+  input_port.GetWrapped()->SetEpochProtectedReads(true);
+  parent->Init();
+  RRLIB_UNIT_TESTS_ASSERT(input_port.GetWrapped()->GetEpochProtectedReads());
+
+  std::string value;
+  for (int i = 0; i < 20; i++)
+  {
+    output_port.Publish(std::to_string(i));
+    input_port.Get(value);
+    RRLIB_UNIT_TESTS_EQUALITY(std::to_string(i), value);
+    RRLIB_UNIT_TESTS_EQUALITY(std::to_string(i), *input_port.GetPointer());
+  }
+
+  // Retired buffers are recycled once epoch has advanced twice
+  RRLIB_UNIT_TESTS_ASSERT(standard::tEpochReclamation::GetRetiredBufferCount() > 0);
+  for (int i = 0; i < 3; i++)
+  {
+    standard::tEpochReclamation::Reclaim();
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(static_cast<size_t>(0), standard::tEpochReclamation::GetRetiredBufferCount());
+  input_port.Get(value);
+  RRLIB_UNIT_TESTS_EQUALITY(std::string("19"), value);
+
+  parent->ManagedDelete();
+}
+
+/*! Object that sets flag on deletion */
+struct tDeletionFlagSetter
+{
+  bool& deleted;
+
+  tDeletionFlagSetter(bool& deleted) : deleted(deleted)
+  {}
+
+  ~tDeletionFlagSetter()
+  {
+    deleted = true;
+  }
+};
+
+void TestEpochObjectRetirement()
+{
+  // Retired objects (e.g. push plans and listener tables) are not deleted while epoch is pinned
+  bool deleted = false;
+  {
+    standard::tEpochReclamation::tReadGuard guard;
+    RRLIB_UNIT_TESTS_ASSERT(guard.Pinned());
+    standard::tEpochReclamation::RetireObject(new tDeletionFlagSetter(deleted));
+    for (int i = 0; i < 3; i++)
+    {
+      standard::tEpochReclamation::Reclaim();
+    }
+    RRLIB_UNIT_TESTS_ASSERT(!deleted);
+  }
+  for (int i = 0; i < 3; i++)
+  {
+    standard::tEpochReclamation::Reclaim();
+  }
+  RRLIB_UNIT_TESTS_ASSERT(deleted);
+
+  // Publishing via port whose push plan and listeners are replaced
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestEpochObjectRetirement");
+  tOutputPort<int> output_port("Output Port", parent);
+  tInputPort<int> input_port("Input Port", parent);
+  output_port.ConnectTo(input_port);
+  parent->Init();
+  output_port.GetWrapped()->SetTopologyFrozen(true);
+  std::vector<std::unique_ptr<tLatestValueListener<int>>> listeners;
+  for (int i = 0; i < 20; i++)
+  {
+    output_port.Publish(i);
+    RRLIB_UNIT_TESTS_EQUALITY(i, input_port.Get());
+    listeners.emplace_back(new tLatestValueListener<int>(input_port));  // replaces listener table - and push plan of output port
+    standard::tEpochReclamation::Reclaim();
+  }
+  output_port.Publish(42);
+  RRLIB_UNIT_TESTS_EQUALITY(42, input_port.Get());
+  for (auto & listener : listeners)
+  {
+    RRLIB_UNIT_TESTS_EQUALITY(42, *listener->GetLatest());
+  }
+  parent->ManagedDelete();
+}
+
+void TestInlineCurrentValue()
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestInlineCurrentValue");
+
+  tOutputPort<int> output_port("Output Port", parent);
+  tInputPort<int> input_port("Input Port", parent);
+  tInputPort<int> input_port_queue("Input Port Queue", parent, tQueueSettings(false));
+  tOutputPort<int> unconnected_port("Unconnected Port", parent);
+  output_port.ConnectTo(input_port);
+  output_port.ConnectTo(input_port_queue);
+  output_port.GetWrapped()->SetInlineCurrentValue(true);
+  input_port.GetWrapped()->SetInlineCurrentValue(true);
+  input_port_queue.GetWrapped()->SetInlineCurrentValue(true);
+  unconnected_port.GetWrapped()->SetInlineCurrentValue(true);
+  parent->Init();
+  RRLIB_UNIT_TESTS_ASSERT(input_port.GetWrapped()->GetInlineCurrentValue());
+  RRLIB_UNIT_TESTS_EQUALITY(0, output_port.Get());
+
+  for (int i = 0; i < 20; i++)
+  {
+    output_port.Publish(i);
+    RRLIB_UNIT_TESTS_EQUALITY(i, input_port.Get());
+    RRLIB_UNIT_TESTS_EQUALITY(i, *input_port.GetPointer());
+    RRLIB_UNIT_TESTS_EQUALITY(i, output_port.Get());
+  }
+
+  // Enqueued buffers are unaffected
+  for (int i = 0; i < 20; i++)
+  {
+    tPortDataPointer<const int> dequeued = input_port_queue.Dequeue();
+    RRLIB_UNIT_TESTS_ASSERT(dequeued);
+    RRLIB_UNIT_TESTS_EQUALITY(i, *dequeued);
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(19, input_port_queue.Get());
+
+  // Publishing via unconnected port without listeners takes no buffer from pool: drain pool - and check that there are no further misses
+  optimized::tGlobalBufferPools& pools = optimized::tGlobalBufferPools::Instance();
+  uint32_t type_index = unconnected_port.GetWrapped()->GetCheaplyCopyableTypeIndex();
+  size_t misses = pools.GetPoolStatistics(type_index).misses;
+  std::vector<optimized::tGlobalBufferPools::tBufferPointer> drained_buffers;
+  while (pools.GetPoolStatistics(type_index).misses == misses)
+  {
+    drained_buffers.push_back(pools.GetUnusedBuffer(type_index));
+  }
+  misses = pools.GetPoolStatistics(type_index).misses;
+  for (int i = 0; i < 20; i++)
+  {
+    unconnected_port.Publish(i);
+    RRLIB_UNIT_TESTS_EQUALITY(i, unconnected_port.Get());
+  }
+  RRLIB_UNIT_TESTS_EQUALITY(misses, pools.GetPoolStatistics(type_index).misses);
+  drained_buffers.clear();
+
+  parent->ManagedDelete();
+}
+
+void TestBufferReuse()
+{
+  core::tFrameworkElement* parent = new core::tFrameworkElement(&core::tRuntimeEnvironment::GetInstance(), "TestBufferReuse");
+
+  tOutputPort<std::vector<int>> output_port("Output Port", parent);
+  tInputPort<std::vector<int>> input_port("Input Port", parent);
+  tOutputPort<std::string> string_port("String Port", parent);
+  output_port.ConnectTo(input_port);
+  parent->Init();
+
+  for (int i = 0; i < 5; i++)
+  {
+    tPortDataPointer<std::vector<int>> buffer = output_port.GetUnusedBuffer();
+    RRLIB_UNIT_TESTS_ASSERT(buffer->empty());
+    buffer->resize(100, i);
+    output_port.Publish(buffer);
+    RRLIB_UNIT_TESTS_ASSERT(input_port.GetPointer()->size() == 100 && input_port.GetPointer()->back() == i);
+  }
+
+  tPortDataPointer<std::string> string_buffer = string_port.GetUnusedBuffer();
+  RRLIB_UNIT_TESTS_ASSERT(string_buffer->empty() && string_buffer->capacity() >= 512);
+
+  parent->ManagedDelete();
+}
+
+template <bool WIDE>
+void TestReferenceCounterLayout(int locks)
+{
+  common::tReferenceAndReuseCounter<WIDE> counter;
+  int tag = counter.Init(locks);
+  RRLIB_UNIT_TESTS_ASSERT(counter.TryLock(1, tag) && (!counter.TryLock(1, tag + 1)));
+  RRLIB_UNIT_TESTS_EQUALITY(locks + 1, counter.GetReferenceCounter(counter.ReleaseLocks(1)));
+  RRLIB_UNIT_TESTS_EQUALITY(locks, counter.GetReferenceCounter(counter.ReleaseLocks(locks)));
+  RRLIB_UNIT_TESTS_ASSERT(!counter.TryLock(1, tag));
+
+  // Tag changes with every reuse
+  RRLIB_UNIT_TESTS_EQUALITY((tag + 1) & counter.cTAG_MASK, counter.Init(1));
+}
+
 class DataPortsTestCollection : public rrlib::util::tUnitTestSuite
 {
   RRLIB_UNIT_TESTS_BEGIN_SUITE(DataPortsTestCollection);
@@ -376,8 +1436,17 @@ class DataPortsTestCollection : public rrlib::util::tUnitTestSuite
     TestPortChains();
     TestPortQueues<int>(1, 2, 3);
     TestPortQueues<std::string>("1", "2", "3");
+    TestBoundedPortQueues<int>(1, 2, 3);
+    TestBoundedPortQueues<std::string>("1", "2", "3");
+#ifndef RRLIB_SINGLE_THREADED
+    TestConcurrentBoundedPortQueue();
+#endif
     TestPortListeners<int>(1);
     TestPortListeners<std::string>("test");
+    TestDeferredPortListeners<int>({ 1, 2, 3 });
+    TestDeferredPortListeners<std::string>({ "1", "2", "3" });
+    TestLatestValueListener<int>(1, 2);
+    TestLatestValueListener<std::string>("1", "2");
     TestNetworkConnectionLoss<int>(4, 7);
     TestNetworkConnectionLoss<std::string>("default_value", "published_value");
     TestOutOfBoundsPublish();
@@ -385,15 +1454,46 @@ class DataPortsTestCollection : public rrlib::util::tUnitTestSuite
     TestHijackedPublishing<std::string>("test");
     TestGenericPorts<bool>(true, false);
     TestGenericPorts<std::string>("123", "45");
+    TestPublishBatch();
+    TestPortStatistics();
+    TestFrozenTopology<int>(1, 2);
+    TestFrozenTopology<std::string>("1", "2");
+    TestPublishLockCount<int>(1, 2);
+    TestPublishLockCount<std::string>("1", "2");
+    TestBulkConnect<int>(1);
+    TestBulkConnect<std::string>("1");
+    TestConnectionTransaction<int>(1);
+    TestConnectionTransaction<std::string>("1");
+    TestPullCache<int>(1, 2);
+    TestPullCache<std::string>("1", "2");
+    TestAsyncPull<int>(1, 2);
+    TestAsyncPull<std::string>("1", "2");
+    TestBufferPoolPrewarming();
+    TestAllocationMonitor();
+    TestStartupProfiler();
+    TestBufferReuse();
+    TestDequeueAllInto();
+    TestNumberConversion();
+    TestThreadLocalBufferCache();
+    TestReferenceCounterLayout<false>(30000);
+    TestReferenceCounterLayout<true>(1000000);
+    TestEpochProtectedReads();
+    TestEpochObjectRetirement();
+    TestInlineCurrentValue();
 
     tThreadLocalBufferManagement local_buffers;
     TestPortChains();
     TestPortQueues<int>(1, 2, 3);
+    TestBoundedPortQueues<int>(1, 2, 3);
     TestPortListeners<int>(1);
     TestNetworkConnectionLoss<int>(4, 7);
     TestOutOfBoundsPublish();
     TestHijackedPublishing<int>(42);
     TestGenericPorts<bool>(true, false);
+    TestPublishBatch();
+    TestFrozenTopology<int>(1, 2);
+    TestPublishLockCount<int>(1, 2);
+    TestDequeueAllInto();
   }
 
   void PortPack()